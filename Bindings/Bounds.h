@@ -0,0 +1,69 @@
+//
+//  Bounds.h
+//
+//  World-space bounds of the renderables of glTF assets and instances.
+//
+
+#ifndef Bounds_h
+#define Bounds_h
+
+#import <filament/Engine.h>
+#import <filament/RenderableManager.h>
+#import <filament/TransformManager.h>
+#import <utils/Entity.h>
+#import "Kernels.h"
+#import "Scratch.h"
+
+#include <cstring>
+
+namespace bindings {
+
+/**
+ * Computes the world-space bounding boxes of the renderables among `entities`, from their
+ * current bounding boxes and world transforms, and returns how many were written. At most
+ * `capacity` boxes are written to `boxes` and, when it is not null, the corresponding entities
+ * to `renderables`.
+ */
+inline size_t worldBoundingBoxes(filament::Engine& engine, const utils::Entity* entities,
+        size_t count, utils::Entity* renderables, Box* boxes, size_t capacity) {
+    auto& rm = engine.getRenderableManager();
+    auto& tm = engine.getTransformManager();
+    ScratchScope scratch;
+    auto matrices = scratch.allocate<simd_float4x4>(std::min(count, capacity));
+    size_t written = 0;
+    for (size_t i = 0; i < count && written < capacity; i++) {
+        auto const ri = rm.getInstance(entities[i]);
+        if (!ri) {
+            continue;
+        }
+        auto const& box = rm.getAxisAlignedBoundingBox(ri);
+        boxes[written] = {
+            simd_make_float3(box.center.x, box.center.y, box.center.z),
+            simd_make_float3(box.halfExtent.x, box.halfExtent.y, box.halfExtent.z)
+        };
+        auto const ti = tm.getInstance(entities[i]);
+        if (ti) {
+            std::memcpy(&matrices[written], &tm.getWorldTransform(ti), sizeof(simd_float4x4));
+        } else {
+            matrices[written] = matrix_identity_float4x4;
+        }
+        if (renderables) {
+            renderables[written] = entities[i];
+        }
+        written++;
+    }
+    transformBoxes(matrices, boxes, written, boxes);
+    return written;
+}
+
+/** The world-space bounding box of all the renderables among `entities`. */
+inline Box worldBoundingBox(filament::Engine& engine, const utils::Entity* entities, size_t count) {
+    ScratchScope scratch;
+    auto boxes = scratch.allocate<Box>(count);
+    size_t const written = worldBoundingBoxes(engine, entities, count, nullptr, boxes, count);
+    return unionOf(boxes, written);
+}
+
+}
+
+#endif /* Bounds_h */
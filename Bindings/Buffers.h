@@ -0,0 +1,84 @@
+//
+//  Buffers.h
+//
+//  Helpers to hand CPU memory to Filament through BufferDescriptor.
+//
+
+#ifndef Buffers_h
+#define Buffers_h
+
+#import <Foundation/Foundation.h>
+#import <backend/BufferDescriptor.h>
+#import <backend/PixelBufferDescriptor.h>
+
+#include <cstring>
+
+namespace bindings {
+
+/**
+ * Creates a BufferDescriptor holding a private copy of `data`.
+ */
+inline filament::backend::BufferDescriptor copiedBuffer(NSData* data) {
+    auto bytes = new uint8_t[data.length];
+    std::memcpy(bytes, data.bytes, data.length);
+    return filament::backend::BufferDescriptor(bytes, data.length, [](void* buffer, size_t, void*) {
+        delete[] (uint8_t*) buffer;
+    });
+}
+
+/**
+ * Makes `descriptor` hold a strong reference to `data` until Filament releases the buffer.
+ *
+ * The reference is carried in the descriptor's user pointer, so no allocation is made. Memory
+ * borrowed through `-[NSData initWithBytesNoCopy:length:deallocator:]` is handed back to its
+ * owner as soon as Filament is done with it. This replaces any callback previously set on the
+ * descriptor.
+ */
+inline void retainData(filament::backend::BufferDescriptor& descriptor, NSData* data) {
+    descriptor.setCallback([](void*, size_t, void* user) {
+        CFBridgingRelease(user);
+    }, (void*) CFBridgingRetain(data));
+}
+
+/**
+ * Creates a BufferDescriptor referencing the bytes of `data` directly.
+ *
+ * `data` is retained and released from the descriptor's callback, so no intermediate copy is
+ * made. The contents must not be mutated until Filament has consumed the upload.
+ */
+inline filament::backend::BufferDescriptor retainedBuffer(NSData* data) {
+    filament::backend::BufferDescriptor descriptor(data.bytes, data.length);
+    retainData(descriptor, data);
+    return descriptor;
+}
+
+/**
+ * Creates a PixelBufferDescriptor referencing `size` bytes of `data` starting at `offset`.
+ *
+ * Like retainedBuffer(), the bytes are not copied and `data` stays alive until Filament has
+ * consumed them.
+ */
+inline filament::backend::PixelBufferDescriptor retainedPixelBuffer(NSData* data,
+        size_t offset, size_t size,
+        filament::backend::PixelDataFormat format, filament::backend::PixelDataType type,
+        uint8_t alignment, uint32_t left, uint32_t top, uint32_t stride) {
+    filament::backend::PixelBufferDescriptor descriptor((const uint8_t*) data.bytes + offset, size,
+            format, type, alignment, left, top, stride);
+    retainData(descriptor, data);
+    return descriptor;
+}
+
+/**
+ * Creates a compressed PixelBufferDescriptor referencing `size` bytes of `data` starting at
+ * `offset`, without copying them.
+ */
+inline filament::backend::PixelBufferDescriptor retainedPixelBuffer(NSData* data,
+        size_t offset, size_t size, filament::backend::CompressedPixelDataType format) {
+    filament::backend::PixelBufferDescriptor descriptor((const uint8_t*) data.bytes + offset, size,
+            format, uint32_t(size));
+    retainData(descriptor, data);
+    return descriptor;
+}
+}
+
+#endif /* Buffers_h */
@@ -0,0 +1,86 @@
+//
+//  Entities.h
+//
+//  Helpers to pass entity arrays between the bindings and Filament without boxing.
+//
+
+#ifndef Entities_h
+#define Entities_h
+
+#import <Foundation/Foundation.h>
+#import <utils/Entity.h>
+#import "Bindings/Filament/Entity.h"
+#import "Scratch.h"
+
+#include <algorithm>
+
+namespace bindings {
+
+// utils::Entity only wraps its 32-bit identity, so arrays of the smuggled Entity type can be
+// handed to Filament as-is.
+static_assert(sizeof(Entity) == sizeof(utils::Entity), "Entity must match utils::Entity");
+static_assert(alignof(Entity) == alignof(utils::Entity), "Entity must match utils::Entity");
+
+inline const utils::Entity* toNative(const Entity* entities) {
+    return reinterpret_cast<const utils::Entity*>(entities);
+}
+inline utils::Entity* toNative(Entity* entities) {
+    return reinterpret_cast<utils::Entity*>(entities);
+}
+inline const Entity* fromNative(const utils::Entity* entities) {
+    return reinterpret_cast<const Entity*>(entities);
+}
+
+// Number of entities unboxed per chunk by the bulk helpers below.
+constexpr size_t ENTITY_CHUNK_COUNT = 4096;
+
+/**
+ * Unboxes `entities` in fixed-size chunks staged in scratch memory and calls
+ * `fn(const utils::Entity* chunk, size_t count)` for each of them.
+ */
+template<typename Fn>
+void forEachEntityChunk(NSArray<NSNumber*>* entities, Fn&& fn) {
+    ScratchScope scratch;
+    auto chunk = scratch.allocate<utils::Entity>(ENTITY_CHUNK_COUNT);
+    size_t count = 0;
+    for (NSNumber* entity in entities) {
+        chunk[count++] = utils::Entity::import(entity.unsignedIntValue);
+        if (count == ENTITY_CHUNK_COUNT) {
+            fn(chunk, count);
+            count = 0;
+        }
+    }
+    if (count) {
+        fn(chunk, count);
+    }
+}
+
+/**
+ * Fills `entities` from `fetch(utils::Entity* chunk, size_t capacity)`, one chunk at a time,
+ * until it is full or `fetch` returns fewer entities than requested. Each fetched entity
+ * replaces the boxed value at the same position.
+ *
+ * @return The total number of entities fetched.
+ */
+template<typename Fetch>
+size_t fillEntityChunks(NSMutableArray<NSNumber*>* entities, Fetch&& fetch) {
+    ScratchScope scratch;
+    auto chunk = scratch.allocate<utils::Entity>(ENTITY_CHUNK_COUNT);
+    size_t total = 0;
+    while (total < entities.count) {
+        size_t const requested = std::min<size_t>(ENTITY_CHUNK_COUNT, entities.count - total);
+        size_t const fetched = fetch(chunk, requested);
+        for (size_t i = 0; i < fetched; i++) {
+            entities[total + i] = @(utils::Entity::smuggle(chunk[i]));
+        }
+        total += fetched;
+        if (fetched < requested) {
+            break;
+        }
+    }
+    return total;
+}
+
+}
+
+#endif /* Entities_h */
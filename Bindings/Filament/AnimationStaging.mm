@@ -0,0 +1,99 @@
+//
+//  AnimationStaging.mm
+//
+#import "Bindings/Filament/AnimationStaging.h"
+#import "Bindings/Filament/RenderableManager.h"
+#import <filament/RenderableManager.h>
+#import "../Math.h"
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+enum class Kind : uint8_t {
+    BONES, BONE_MATRICES, MORPH_WEIGHTS
+};
+
+struct Update {
+    EntityInstance instance;
+    Kind kind;
+    uint32_t count;
+    uint32_t offset;
+    // index of the first float4 of this update in Buffer::data
+    size_t first;
+};
+
+// Payloads are stored as float4 so bones and matrices stay aligned; morph weights are padded.
+struct Buffer {
+    std::vector<Update> updates;
+    std::vector<simd_float4> data;
+
+    void clear() {
+        updates.clear();
+        data.clear();
+    }
+};
+
+}
+
+@implementation AnimationStaging{
+    std::mutex lock;
+    Buffer buffers[2];
+    Buffer* back;
+    Buffer* front;
+}
+
+- (id) init{
+    self = [super init];
+    self->back = &buffers[0];
+    self->front = &buffers[1];
+    return self;
+}
+
+- (void) stage:(EntityInstance)instance :(Kind)kind :(const void *)payload :(size_t)bytes :(size_t)count :(size_t)offset{
+    auto const rows = (bytes + sizeof(simd_float4) - 1) / sizeof(simd_float4);
+    std::lock_guard<std::mutex> guard(lock);
+    auto const first = back->data.size();
+    back->data.resize(first + rows);
+    std::memcpy(back->data.data() + first, payload, bytes);
+    back->updates.push_back({ instance, kind, uint32_t(count), uint32_t(offset), first });
+}
+
+- (void)stageBones:(EntityInstance)instance :(const simd_float4 *)transforms :(size_t)boneCount :(size_t)offset{
+    [self stage:instance :Kind::BONES :transforms :2 * boneCount * sizeof(simd_float4) :boneCount :offset];
+}
+- (void)stageBoneMatrices:(EntityInstance)instance :(const simd_float4x4 *)transforms :(size_t)boneCount :(size_t)offset{
+    [self stage:instance :Kind::BONE_MATRICES :transforms :boneCount * sizeof(simd_float4x4) :boneCount :offset];
+}
+- (void)stageMorphWeights:(EntityInstance)instance :(const float *)weights :(size_t)count :(size_t)offset{
+    [self stage:instance :Kind::MORPH_WEIGHTS :weights :count * sizeof(float) :count :offset];
+}
+
+- (size_t)flush:(RenderableManager *)manager{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::swap(back, front);
+    }
+    auto rm = (filament::RenderableManager*) manager.manager;
+    for(auto const& update : front->updates){
+        auto payload = front->data.data() + update.first;
+        switch(update.kind){
+            case Kind::BONES:
+                rm->setBones(update.instance, BONES_FROM_SIMD(payload), update.count, update.offset);
+                break;
+            case Kind::BONE_MATRICES:
+                rm->setBones(update.instance, MAT4F_ARRAY_FROM_SIMD(payload), update.count, update.offset);
+                break;
+            case Kind::MORPH_WEIGHTS:
+                rm->setMorphWeights(update.instance, (const float*) payload, update.count, update.offset);
+                break;
+        }
+    }
+    auto const applied = front->updates.size();
+    front->clear();
+    return applied;
+}
+
+@end
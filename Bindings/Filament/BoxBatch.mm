@@ -0,0 +1,25 @@
+//
+//  BoxBatch.mm
+//
+#import "Bindings/Filament/BoxBatch.h"
+#import "../Kernels.h"
+
+@implementation BoxBatch
+
++ (void)transform:(const simd_float4x4 *)matrices :(const Box *)boxes :(size_t)count :(Box *)result{
+    bindings::transformBoxes(matrices, boxes, count, result);
+}
+
++ (void)transformArrays:(const simd_float4x4 *)matrices :(BoxArrays)boxes :(size_t)count :(BoxArrays)result{
+    bindings::transformBoxes(matrices, boxes, count, result);
+}
+
++ (void)transformAll:(simd_float4x4)matrix :(BoxArrays)boxes :(size_t)count :(BoxArrays)result{
+    bindings::transformBoxes(matrix, boxes, count, result);
+}
+
++ (Box)unionOf:(const Box *)boxes :(size_t)count{
+    return bindings::unionOf(boxes, count);
+}
+
+@end
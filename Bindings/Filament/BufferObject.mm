@@ -7,6 +7,7 @@
 #import "Bindings/Filament/BufferObject.h"
 #import <filament/BufferObject.h>
 #import <filament/Engine.h>
+#import "../Buffers.h"
 
 @implementation BufferObject{
     filament::BufferObject* nativeObject;
@@ -19,13 +20,11 @@
 }
 
 - (void)setBuffer:(nonnull Engine *)engine :(nonnull NSData *)buffer :(uint32_t)byteOffset {
-    const auto deleter = [](void* buffer, size_t size, void* user) {
-        delete (uint8_t*) buffer;
-    };
-    auto start = (uint8_t*) buffer.bytes;
-    auto bytes = new uint8_t[buffer.length];
-    std::copy(start, start+buffer.length, bytes);
-    nativeObject->setBuffer(*(filament::Engine*)engine.engine, filament::BufferObject::BufferDescriptor(bytes, buffer.length, deleter), byteOffset);
+    nativeObject->setBuffer(*(filament::Engine*)engine.engine, bindings::copiedBuffer(buffer), byteOffset);
+}
+
+- (void)setBufferNoCopy:(nonnull Engine *)engine :(nonnull NSData *)buffer :(uint32_t)byteOffset {
+    nativeObject->setBuffer(*(filament::Engine*)engine.engine, bindings::retainedBuffer(buffer), byteOffset);
 }
 
 - (size_t)getByteCount {
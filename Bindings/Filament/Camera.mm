@@ -83,6 +83,12 @@
     return SIMD_DOUBLE4X4_FROM_MAT4(matrix);
 }
 
+- (Frustum *)getFrustum{
+    // equivalent to Camera::getFrustum()
+    auto matrix = filament::math::mat4f(nativeCamera->getCullingProjectionMatrix() * nativeCamera->getViewMatrix());
+    return [[Frustum alloc] init:SIMD_FLOAT4X4_FROM_MAT4(matrix)];
+}
+
 - (simd_double3)getPosition{
     auto position = nativeCamera->getPosition();
     return SIMD_DOUBLE3_FROM_FLOAT3(position);
@@ -7,6 +7,7 @@
 #import <filament/ColorGrading.h>
 #import "Bindings/Filament/ToneMapper.h"
 #import "../Math.h"
+#import "../Wrappers.h"
 
 @implementation ColorGradingBuilder{
     filament::ColorGrading::Builder* nativeBuilder;
@@ -83,7 +84,7 @@
     return self;
 }
 - (ColorGrading *)build:(Engine *)engine{
-    return [[ColorGrading alloc] init: nativeBuilder->build(*(filament::Engine*) engine.engine)];
+    return bindings::wrap<ColorGrading>(nativeBuilder->build(*(filament::Engine*) engine.engine), engine.engine);
 }
 
 @end
@@ -8,6 +8,7 @@
 #import <filament/Engine.h>
 #import <utils/Entity.h>
 #import "Bindings/Filament/RenderableManager.h"
+#import "../Wrappers.h"
 
 @implementation Engine{
     filament::Engine* nativeEngine;
@@ -29,10 +30,12 @@
 }
 
 + (void) destroy: (Engine*)engine{
+    bindings::forgetWrappersOwnedBy(engine->nativeEngine);
     filament::Engine::destroy(engine->nativeEngine);
 }
 
 - (void) dealloc{
+    bindings::forgetWrappersOwnedBy(nativeEngine);
     filament::Engine::destroy(nativeEngine);
 }
 
@@ -42,85 +45,88 @@
 
 - (SwapChain*) createSwapChain: (CALayer*)layer{
     auto swapchain = nativeEngine->createSwapChain( (__bridge void*) layer);
-    return [[SwapChain alloc] init:swapchain];
+    return bindings::wrap<SwapChain>(swapchain, nativeEngine);
 }
 
 - (SwapChain*) createSwapChain:(uint32_t)width :(uint32_t)height{
     auto swapchain = nativeEngine->createSwapChain(width, height);
-    return [[SwapChain alloc] init:swapchain];
+    return bindings::wrap<SwapChain>(swapchain, nativeEngine);
 }
 
 - (void) destroySwapChain:(SwapChain *)swapchain{
+    bindings::forgetWrapper(swapchain.swapchain);
     nativeEngine->destroy( (filament::SwapChain*) swapchain.swapchain);
 }
 
 - (Renderer*) createRenderer{
     auto renderer = nativeEngine->createRenderer();
-    return [[Renderer alloc] init: renderer];
+    return bindings::wrap<Renderer>(renderer, nativeEngine);
 }
 
 - (void) destroyRenderer:(Renderer *)renderer{
+    bindings::forgetWrapper(renderer.renderer);
     nativeEngine->destroy( (filament::Renderer*) renderer.renderer);
 }
 
 
 - (Camera*) createCamera:(Entity)entity{
     auto camera = nativeEngine->createCamera(utils::Entity::import(entity));
-    return [[Camera alloc] init:camera];
+    return bindings::wrap<Camera>(camera, nativeEngine);
 }
 
 - (Camera*) getCameraComponent:(Entity)entity{
     auto camera = nativeEngine->getCameraComponent(utils::Entity::import(entity));
-    if (camera){
-        return [[Camera alloc] init:camera];
-    }
-    return nil;
+    return bindings::wrap<Camera>(camera, nativeEngine);
 }
 
 - (void) destroyCameraComponent:(Entity)entity{
+    bindings::forgetWrapper(nativeEngine->getCameraComponent(utils::Entity::import(entity)));
     nativeEngine->destroyCameraComponent(utils::Entity::import(entity));
 }
 
 - (Scene*) createScene{
     auto scene = nativeEngine->createScene();
-    return [[Scene alloc] init: scene];
+    return bindings::wrap<Scene>(scene, nativeEngine);
 }
 
 - (void) destroyScene:(Scene *)scene{
+    bindings::forgetWrapper(scene.scene);
     nativeEngine->destroy( (filament::Scene*) scene.scene);
 }
 
 - (View*) createView{
     auto view = nativeEngine->createView();
-    return [[View alloc] init: view];
+    return bindings::wrap<View>(view, nativeEngine);
 }
 
 - (void) destroyView:(View *)view{
+    bindings::forgetWrapper(view.view);
     nativeEngine->destroy( (filament::View*) view.view);
 }
 
 - (void) destroyEntity:(Entity)entity{
+    bindings::forgetWrapper(nativeEngine->getCameraComponent(utils::Entity::import(entity)));
     nativeEngine->destroy(utils::Entity::import(entity));
 }
 
 - (EntityManager*) getEntityManager{
     auto manager = &nativeEngine->getEntityManager();
-    return [[EntityManager alloc] init: manager];
+    return bindings::wrap<EntityManager>(manager, nativeEngine);
 }
 
 - (TransformManager*) getTransformManager{
     auto manager = &nativeEngine->getTransformManager();
-    return [[TransformManager alloc] init: manager];
+    return bindings::wrap<TransformManager>(manager, nativeEngine);
 }
 
 - (LightManager*) getLightManager{
     auto manager = &nativeEngine->getLightManager();
-    return [[LightManager alloc] init: manager];
+    return bindings::wrap<LightManager>(manager, nativeEngine);
 }
 
 - (RenderableManager*) getRenderableManager{
     auto manager = &nativeEngine->getRenderableManager();
-    return [[RenderableManager alloc] init: manager];
+    return bindings::wrap<RenderableManager>(manager, nativeEngine);
 }
 
 @end
@@ -7,6 +7,54 @@
 
 #import "Bindings/Filament/EntityManager.h"
 #import <utils/EntityManager.h>
+#import "../Entities.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// Number of entities a thread reserves at once; larger requests bypass the reservation.
+constexpr size_t RESERVATION_SIZE = 256;
+
+/** Entities created in bulk by one thread, handed out without taking the manager's lock. */
+struct Reservation {
+    utils::EntityManager* manager = nullptr;
+    std::vector<utils::Entity> entities;
+
+    ~Reservation() {
+        release();
+    }
+
+    void release() {
+        if (!entities.empty()) {
+            manager->destroy(entities.size(), entities.data());
+            entities.clear();
+        }
+    }
+
+    void take(utils::EntityManager* from, size_t count, utils::Entity* out) {
+        if (manager != from) {
+            release();
+            manager = from;
+        }
+        if (count >= RESERVATION_SIZE) {
+            from->create(count, out);
+            return;
+        }
+        if (entities.size() < count) {
+            size_t const available = entities.size();
+            entities.resize(available + RESERVATION_SIZE);
+            from->create(RESERVATION_SIZE, entities.data() + available);
+        }
+        std::copy(entities.end() - count, entities.end(), out);
+        entities.resize(entities.size() - count);
+    }
+};
+
+thread_local Reservation reservation;
+
+}
 
 @implementation EntityManager{
     utils::EntityManager* nativeManager;
@@ -29,6 +77,26 @@
     return nativeManager->isAlive(utils::Entity::import(entity));
 }
 
+- (void)create:(size_t)count :(Entity *)entities{
+    nativeManager->create(count, bindings::toNative(entities));
+}
+- (void)destroy:(const Entity *)entities :(size_t)count{
+    // destroy() only reads the array
+    nativeManager->destroy(count, const_cast<utils::Entity*>(bindings::toNative(entities)));
+}
+
+- (Entity)createReserved{
+    utils::Entity entity;
+    reservation.take(nativeManager, 1, &entity);
+    return utils::Entity::smuggle(entity);
+}
+- (void)createReserved:(size_t)count :(Entity *)entities{
+    reservation.take(nativeManager, count, bindings::toNative(entities));
+}
+- (void)releaseReservation{
+    reservation.release();
+}
+
 + (instancetype)get{
     return [[EntityManager alloc] init: &utils::EntityManager::get()];
 }
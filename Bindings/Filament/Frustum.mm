@@ -0,0 +1,158 @@
+//
+//  Frustum.mm
+//
+#import "Bindings/Filament/Frustum.h"
+#import <filament/Box.h>
+#import <filament/Frustum.h>
+#import "../Kernels.h"
+#import "../Math.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+using bindings::load8;
+
+// A plane splatted across the lanes, with the absolute values of its normal for the boxes.
+struct Plane {
+    simd_float8 x, y, z, w;
+    simd_float8 ax, ay, az;
+};
+
+struct Planes {
+    Plane planes[6];
+
+    explicit Planes(filament::Frustum const& frustum) {
+        auto const equations = frustum.getNormalizedPlanes();
+        for (int i = 0; i < 6; i++) {
+            auto const& p = equations[i];
+            auto& plane = planes[i];
+            plane.x = p.x;
+            plane.y = p.y;
+            plane.z = p.z;
+            plane.w = p.w;
+            plane.ax = std::abs(p.x);
+            plane.ay = std::abs(p.y);
+            plane.az = std::abs(p.z);
+        }
+    }
+};
+
+// Packs the lanes that are not outside into the low bits of a mask.
+uint32_t visibleMask(simd_int8 outside) {
+    uint32_t mask = 0;
+    for (int k = 0; k < 8; k++) {
+        mask |= uint32_t(outside[k] == 0) << k;
+    }
+    return mask;
+}
+
+/**
+ * Writes the visibility bits of `count` volumes, eight at a time, and returns how many are
+ * visible. `outside(first)` returns the lanes of volumes `first` to `first + 7` that lie outside
+ * at least one plane, and `outsideOne(i)` tests the volumes left over.
+ */
+template<typename Outside, typename OutsideOne>
+size_t cull(size_t count, uint32_t* visibility, Outside outside, OutsideOne outsideOne) {
+    std::memset(visibility, 0, ((count + 31) / 32) * sizeof(uint32_t));
+    size_t visible = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint32_t const mask = visibleMask(outside(i));
+        visibility[i / 32] |= mask << (i % 32);
+        visible += __builtin_popcount(mask);
+    }
+    for (; i < count; i++) {
+        if (!outsideOne(i)) {
+            visibility[i / 32] |= 1u << (i % 32);
+            visible++;
+        }
+    }
+    return visible;
+}
+
+}
+
+@implementation Frustum{
+    filament::Frustum frustum;
+}
+
+- (instancetype)init:(simd_float4x4)projectionView{
+    self = [super init];
+    frustum.setProjection(MAT4F_FROM_SIMD(projectionView));
+    return self;
+}
+
+- (void)setProjection:(simd_float4x4)projectionView{
+    frustum.setProjection(MAT4F_FROM_SIMD(projectionView));
+}
+
+- (simd_float4)getNormalizedPlane:(FrustumPlane)plane{
+    auto const p = frustum.getNormalizedPlane((filament::Frustum::Plane) plane);
+    return simd_make_float4(p.x, p.y, p.z, p.w);
+}
+
+- (bool)intersectsBox:(Box)box{
+    return frustum.intersects(FROM_BOX(box));
+}
+
+- (bool)intersectsSphere:(simd_float4)sphere{
+    return frustum.intersects(FLOAT4_FROM_SIMD(sphere));
+}
+
+- (float)contains:(simd_float3)point{
+    return frustum.contains(FLOAT3_FROM_SIMD(point));
+}
+
+- (size_t)intersectBoxes:(const float *)centerX :(const float *)centerY :(const float *)centerZ :(const float *)halfExtentX :(const float *)halfExtentY :(const float *)halfExtentZ :(size_t)count :(uint32_t *)visibility{
+    Planes const planes(frustum);
+    auto const equations = frustum.getNormalizedPlanes();
+    // a box is outside when its center is further from a plane than its projected extent
+    return cull(count, visibility, [&](size_t i) {
+        simd_float8 const cx = load8(centerX + i), cy = load8(centerY + i), cz = load8(centerZ + i);
+        simd_float8 const ex = load8(halfExtentX + i), ey = load8(halfExtentY + i), ez = load8(halfExtentZ + i);
+        simd_int8 outside = 0;
+        for (auto const& p : planes.planes) {
+            simd_float8 const distance = p.x * cx + p.y * cy + p.z * cz + p.w;
+            simd_float8 const extent = p.ax * ex + p.ay * ey + p.az * ez;
+            outside |= distance - extent > 0;
+        }
+        return outside;
+    }, [&](size_t i) {
+        for (int k = 0; k < 6; k++) {
+            auto const& p = equations[k];
+            float const distance = p.x * centerX[i] + p.y * centerY[i] + p.z * centerZ[i] + p.w;
+            float const extent = std::abs(p.x) * halfExtentX[i] + std::abs(p.y) * halfExtentY[i]
+                    + std::abs(p.z) * halfExtentZ[i];
+            if (distance - extent > 0) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+- (size_t)intersectSpheres:(const float *)centerX :(const float *)centerY :(const float *)centerZ :(const float *)radius :(size_t)count :(uint32_t *)visibility{
+    Planes const planes(frustum);
+    auto const equations = frustum.getNormalizedPlanes();
+    return cull(count, visibility, [&](size_t i) {
+        simd_float8 const cx = load8(centerX + i), cy = load8(centerY + i), cz = load8(centerZ + i);
+        simd_float8 const r = load8(radius + i);
+        simd_int8 outside = 0;
+        for (auto const& p : planes.planes) {
+            outside |= p.x * cx + p.y * cy + p.z * cz + p.w - r > 0;
+        }
+        return outside;
+    }, [&](size_t i) {
+        for (int k = 0; k < 6; k++) {
+            auto const& p = equations[k];
+            if (p.x * centerX[i] + p.y * centerY[i] + p.z * centerZ[i] + p.w - radius[i] > 0) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+@end
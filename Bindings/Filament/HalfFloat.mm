@@ -0,0 +1,22 @@
+//
+//  HalfFloat.mm
+//
+#import "Bindings/Filament/HalfFloat.h"
+#import "../Kernels.h"
+
+@implementation HalfFloat
+
++ (void)fromFloats:(const float *)values :(size_t)count :(uint16_t *)result{
+    bindings::floatsToHalves(values, count, result);
+}
+
++ (void)fromFloats:(const float *)values :(size_t)count :(uint16_t *)result :(HalfRounding)rounding{
+    bindings::floatsToHalves(values, count, result, rounding == HalfRoundingTowardZero
+            ? bindings::HalfRounding::TOWARD_ZERO : bindings::HalfRounding::NEAREST_EVEN);
+}
+
++ (void)toFloats:(const uint16_t *)values :(size_t)count :(float *)result{
+    bindings::halvesToFloats(values, count, result);
+}
+
+@end
@@ -6,6 +6,7 @@
 #import "Bindings/Filament/IndexBuffer.h"
 #import <filament/IndexBuffer.h>
 #import "Bindings/Filament/Engine.h"
+#import "../Buffers.h"
 
 @implementation IndexBuffer{
     filament::IndexBuffer* nativeBuffer;
@@ -17,15 +18,10 @@
     return self;
 }
 - (void)setBuffer:(Engine *)engine :(NSData *)buffer :(uint32_t)byteOffset{
-    const auto deleter = [](void* buffer, size_t size, void* user) {
-        delete (uint8_t*) buffer;
-    };
-    auto start = (uint8_t*) buffer.bytes;
-    auto bytes = new uint8_t[buffer.length];
-    std::copy(start, start+buffer.length, bytes);
-    
-    
-    nativeBuffer->setBuffer(*(filament::Engine*) engine.engine, filament::IndexBuffer::BufferDescriptor(bytes, buffer.length, deleter));
+    nativeBuffer->setBuffer(*(filament::Engine*) engine.engine, bindings::copiedBuffer(buffer), byteOffset);
+}
+- (void)setBufferNoCopy:(Engine *)engine :(NSData *)buffer :(uint32_t)byteOffset{
+    nativeBuffer->setBuffer(*(filament::Engine*) engine.engine, bindings::retainedBuffer(buffer), byteOffset);
 }
 - (size_t)getIndexCount{
     return nativeBuffer->getIndexCount();
@@ -33,4 +29,7 @@
 - (void)setBuffer:(Engine *)engine :(NSData *)buffer{
     [self setBuffer:engine :buffer :0];
 }
+- (void)setBufferNoCopy:(Engine *)engine :(NSData *)buffer{
+    [self setBufferNoCopy:engine :buffer :0];
+}
 @end
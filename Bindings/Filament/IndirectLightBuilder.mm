@@ -6,6 +6,7 @@
 #import "Bindings/Filament/IndirectLightBuilder.h"
 #import <filament/IndirectLight.h>
 #import "../Math.h"
+#import "../Wrappers.h"
 
 @implementation IndirectLightBuilder{
     filament::IndirectLight::Builder* nativeBuilder;
@@ -60,7 +61,7 @@
 }
 - (IndirectLight *)build:(Engine *)engine{
     auto light = nativeBuilder->build(*(filament::Engine*) engine.engine);
-    return [[IndirectLight alloc] init:light];
+    return bindings::wrap<IndirectLight>(light, engine.engine);
 }
 
 @end
@@ -5,9 +5,37 @@
 //
 #import "Bindings/Filament/Material.h"
 #import <filament/Material.h>
+#import "../Scratch.h"
+#import "../Wrappers.h"
+
+#include <string>
+
 @implementation Parameter
 @end
 
+@interface ParameterHandle ()
+- (nonnull id) initWithInfo: (const filament::Material::ParameterInfo&) info;
+@end
+
+@implementation ParameterHandle{
+    std::string nativeName;
+}
+
+- (id) initWithInfo:(const filament::Material::ParameterInfo&)info{
+    self->nativeName = info.name;
+    self->_name = [[NSString alloc] initWithUTF8String:info.name];
+    self->_type = (ParameterType)info.type;
+    self->_count = info.count;
+    return self;
+}
+- (const char *)nameData{
+    return nativeName.c_str();
+}
+- (size_t)nameLength{
+    return nativeName.size();
+}
+@end
+
 
 @implementation Material{
     filament::Material* nativeMaterial;
@@ -20,10 +48,10 @@
 }
 
 - (MaterialInstance *)createInstance{
-    return [[MaterialInstance alloc] init: nativeMaterial->createInstance()];
+    return bindings::wrap<MaterialInstance>(nativeMaterial->createInstance());
 }
 - (MaterialInstance *)createInstance:(NSString *)name{
-    return [[MaterialInstance alloc] init: nativeMaterial->createInstance(name.UTF8String)];
+    return bindings::wrap<MaterialInstance>(nativeMaterial->createInstance(name.UTF8String));
 }
 - (Shading)getShading{
     return (Shading) nativeMaterial->getShading();
@@ -76,10 +104,11 @@
 }
 - (NSArray<Parameter *> *)getParameters{
     auto count = nativeMaterial->getParameterCount();
-    filament::Material::ParameterInfo params[count];
+    bindings::ScratchScope scratch;
+    auto params = scratch.allocate<filament::Material::ParameterInfo>(count);
     auto available = nativeMaterial->getParameters(params, count);
     auto res = [[NSMutableArray<Parameter*> alloc] init];
-    for(auto i = 0; i<count; i++){
+    for(auto i = 0; i<available; i++){
         auto param = params[i];
         auto _param = [[Parameter alloc] init];
         _param.type = (ParameterType)param.type;
@@ -91,6 +120,19 @@
     }
     return res;
 }
+- (ParameterHandle *)getParameterHandle:(NSString *)name{
+    auto str = name.UTF8String;
+    auto count = nativeMaterial->getParameterCount();
+    bindings::ScratchScope scratch;
+    auto params = scratch.allocate<filament::Material::ParameterInfo>(count);
+    auto available = nativeMaterial->getParameters(params, count);
+    for(auto i = 0; i<available; i++){
+        if(strcmp(params[i].name, str) == 0){
+            return [[ParameterHandle alloc] initWithInfo:params[i]];
+        }
+    }
+    return nil;
+}
 - (bool)hasParameter:(NSString *)name{
     return nativeMaterial->hasParameter(name.UTF8String);
 }
@@ -134,7 +176,7 @@
     nativeMaterial->setDefaultParameter(name.UTF8String, (filament::Texture*) texture.texture, *(filament::TextureSampler*) sampler.sampler);
 }
 - (nonnull MaterialInstance *)getDefaultInstance {
-    return [[MaterialInstance alloc] init:nativeMaterial->getDefaultInstance()];
+    return bindings::wrap<MaterialInstance>(nativeMaterial->getDefaultInstance());
 }
 
 - (nonnull NSString *)getName {
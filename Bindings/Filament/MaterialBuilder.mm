@@ -6,6 +6,7 @@
 #import "Bindings/Filament/MaterialBuilder.h"
 #import <filament/Material.h>
 #import <filament/Engine.h>
+#import "../Wrappers.h"
 
 @implementation MaterialBuilder{
     filament::Material::Builder* nativeBuilder;
@@ -38,6 +39,6 @@
 - (Material*)build:(Engine *)engine{
     auto nEngine = (filament::Engine*) engine.engine;
     auto material = nativeBuilder->build(*nEngine);
-    return [[Material alloc] init:material];
+    return bindings::wrap<Material>(material, engine.engine);
 }
 @end
@@ -4,10 +4,12 @@
 //  Created by Stef Tervelde on 30.06.22.
 //
 #import "Bindings/Filament/MaterialInstance.h"
+#import "Bindings/Filament/ParameterBlock.h"
 #import <filament/MaterialInstance.h>
 #import <filament/Texture.h>
 #import <filament/TextureSampler.h>
 #import "../Math.h"
+#import "../Wrappers.h"
 
 @implementation MaterialInstance{
     filament::MaterialInstance* nativeInstance;
@@ -21,7 +23,7 @@
 
 + (instancetype)duplicate:(MaterialInstance *)instance{
     auto duplicate = filament::MaterialInstance::duplicate( (filament::MaterialInstance*)  instance.instance);
-    return [[MaterialInstance alloc] init: duplicate];
+    return bindings::wrap<MaterialInstance>(duplicate);
 }
 - (NSString *)getName{
     return [[NSString alloc] initWithUTF8String: nativeInstance->getName()];
@@ -71,6 +73,9 @@
 - (void)setParameterTexture:(NSString *)name :(Texture *)texture :(TextureSampler *)sampler{
     nativeInstance->setParameter(name.UTF8String, (filament::Texture*) texture.texture, *(filament::TextureSampler*) sampler.sampler);
 }
+- (void)setParameters:(ParameterBlock *)block{
+    [block applyTo:self];
+}
 - (void)setScissor:(int)left :(int)bottom :(int)width :(int)height{
     nativeInstance->setScissor(left, bottom, width, height);
 }
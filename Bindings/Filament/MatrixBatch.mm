@@ -0,0 +1,41 @@
+//
+//  MatrixBatch.mm
+//
+#import "Bindings/Filament/MatrixBatch.h"
+#import "../Kernels.h"
+
+@implementation MatrixBatch
+
++ (void)multiply:(const simd_float4x4 *)a :(const simd_float4x4 *)b :(size_t)count :(simd_float4x4 *)result{
+    bindings::multiply(a, b, count, result);
+}
+
++ (void)multiplyAll:(simd_float4x4)a :(const simd_float4x4 *)b :(size_t)count :(simd_float4x4 *)result{
+    bindings::multiply(a, b, count, result);
+}
+
++ (void)transform:(const simd_float4x4 *)matrices :(const simd_float4 *)vectors :(size_t)count :(simd_float4 *)result{
+    bindings::transform(matrices, vectors, count, result);
+}
+
++ (void)transformAll:(simd_float4x4)matrix :(const simd_float4 *)vectors :(size_t)count :(simd_float4 *)result{
+    bindings::transform(matrix, vectors, count, result);
+}
+
++ (void)affineInverse:(const simd_float4x4 *)matrices :(size_t)count :(simd_float4x4 *)result{
+    bindings::affineInverse(matrices, count, result);
+}
+
++ (void)normalMatrices:(const simd_float4x4 *)matrices :(size_t)count :(simd_float3x3 *)result{
+    bindings::normalMatrices(matrices, count, result);
+}
+
++ (void)rotationMatrices:(const simd_quatf *)rotations :(size_t)count :(simd_float3x3 *)result{
+    bindings::rotationMatrices(rotations, count, result);
+}
+
++ (void)composeTRS:(const simd_float3 *)translations :(const simd_quatf *)rotations :(const simd_float3 *)scales :(size_t)count :(simd_float4x4 *)result{
+    bindings::composeTRS(translations, rotations, scales, count, result);
+}
+
+@end
@@ -5,6 +5,7 @@
 //
 #import "Bindings/Filament/MorphTargetBufferBuilder.h"
 #import <filament/MorphTargetBuffer.h>
+#import "../Wrappers.h"
 
 @implementation MorphTargetBufferBuilder{
     filament::MorphTargetBuffer::Builder* nativeBuilder;
@@ -27,7 +28,7 @@
 }
 
 - (nonnull MorphTargetBuffer *)build:(nonnull Engine *)engine {
-    return [[MorphTargetBuffer alloc] init:nativeBuilder->build(*(filament::Engine*)engine.engine)];
+    return bindings::wrap<MorphTargetBuffer>(nativeBuilder->build(*(filament::Engine*)engine.engine), engine.engine);
 }
 
 @end
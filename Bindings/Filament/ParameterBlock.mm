@@ -0,0 +1,142 @@
+//
+//  ParameterBlock.mm
+//
+#import "Bindings/Filament/ParameterBlock.h"
+#import <filament/MaterialInstance.h>
+#import "../Math.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+enum class Kind : uint8_t {
+    BOOL, BOOL2, BOOL3, BOOL4,
+    FLOAT, FLOAT2, FLOAT3, FLOAT4,
+    INT, INT2, INT3, INT4,
+    MAT3F, MAT4F
+};
+
+struct Entry {
+    ParameterHandle* handle; // keeps name alive
+    const char* name;
+    size_t nameLength;
+    Kind kind;
+    alignas(16) uint8_t value[sizeof(filament::math::mat4f)];
+};
+
+template<typename T>
+void apply(filament::MaterialInstance* instance, Entry const& entry) {
+    instance->setParameter(entry.name, entry.nameLength, *reinterpret_cast<const T*>(entry.value));
+}
+
+}
+
+@implementation ParameterBlock{
+    std::vector<Entry> entries;
+}
+
+- (id) init{
+    self = [super init];
+    return self;
+}
+
+- (void) set:(ParameterHandle *)handle :(Kind)kind :(const void *)value :(size_t)size{
+    for(auto& entry : entries){
+        if(entry.handle == handle){
+            entry.kind = kind;
+            std::memcpy(entry.value, value, size);
+            return;
+        }
+    }
+    Entry entry{ handle, handle.nameData, handle.nameLength, kind };
+    std::memcpy(entry.value, value, size);
+    entries.push_back(entry);
+}
+
+- (void)setBool:(ParameterHandle *)handle :(bool)boolean{
+    [self set:handle :Kind::BOOL :&boolean :sizeof(boolean)];
+}
+- (void)setFloat:(ParameterHandle *)handle :(float)decimal{
+    [self set:handle :Kind::FLOAT :&decimal :sizeof(decimal)];
+}
+- (void)setInt:(ParameterHandle *)handle :(int)integer{
+    [self set:handle :Kind::INT :&integer :sizeof(integer)];
+}
+- (void)setBool2:(ParameterHandle *)handle :(bool)boolean1 :(bool)boolean2{
+    auto value = filament::math::bool2(boolean1, boolean2);
+    [self set:handle :Kind::BOOL2 :&value :sizeof(value)];
+}
+- (void)setFloat2:(ParameterHandle *)handle :(simd_float2)vector{
+    auto value = filament::math::float2(vector.x, vector.y);
+    [self set:handle :Kind::FLOAT2 :&value :sizeof(value)];
+}
+- (void)setInt2:(ParameterHandle *)handle :(simd_int2)vector{
+    auto value = filament::math::int2(vector.x, vector.y);
+    [self set:handle :Kind::INT2 :&value :sizeof(value)];
+}
+- (void)setBool3:(ParameterHandle *)handle :(bool)boolean1 :(bool)boolean2 :(bool)boolean3{
+    auto value = filament::math::bool3(boolean1, boolean2, boolean3);
+    [self set:handle :Kind::BOOL3 :&value :sizeof(value)];
+}
+- (void)setFloat3:(ParameterHandle *)handle :(simd_float3)vector{
+    auto value = filament::math::float3(vector.x, vector.y, vector.z);
+    [self set:handle :Kind::FLOAT3 :&value :sizeof(value)];
+}
+- (void)setInt3:(ParameterHandle *)handle :(simd_int3)vector{
+    auto value = filament::math::int3(vector.x, vector.y, vector.z);
+    [self set:handle :Kind::INT3 :&value :sizeof(value)];
+}
+- (void)setBool4:(ParameterHandle *)handle :(bool)boolean1 :(bool)boolean2 :(bool)boolean3 :(bool)boolean4{
+    auto value = filament::math::bool4(boolean1, boolean2, boolean3, boolean4);
+    [self set:handle :Kind::BOOL4 :&value :sizeof(value)];
+}
+- (void)setFloat4:(ParameterHandle *)handle :(simd_float4)vector{
+    auto value = filament::math::float4(vector.x, vector.y, vector.z, vector.w);
+    [self set:handle :Kind::FLOAT4 :&value :sizeof(value)];
+}
+- (void)setInt4:(ParameterHandle *)handle :(simd_int4)vector{
+    auto value = filament::math::int4(vector.x, vector.y, vector.z, vector.w);
+    [self set:handle :Kind::INT4 :&value :sizeof(value)];
+}
+- (void)setMat3f:(ParameterHandle *)handle :(simd_float3x3)matrix{
+    auto value = MAT3F_FROM_SIMD(matrix);
+    [self set:handle :Kind::MAT3F :&value :sizeof(value)];
+}
+- (void)setMat4f:(ParameterHandle *)handle :(simd_float4x4)matrix{
+    auto value = MAT4F_FROM_SIMD(matrix);
+    [self set:handle :Kind::MAT4F :&value :sizeof(value)];
+}
+
+- (void)applyTo:(MaterialInstance *)materialInstance{
+    using namespace filament::math;
+    auto instance = (filament::MaterialInstance*) materialInstance.instance;
+    for(auto const& entry : entries){
+        switch(entry.kind){
+            case Kind::BOOL: apply<bool>(instance, entry); break;
+            case Kind::BOOL2: apply<bool2>(instance, entry); break;
+            case Kind::BOOL3: apply<bool3>(instance, entry); break;
+            case Kind::BOOL4: apply<bool4>(instance, entry); break;
+            case Kind::FLOAT: apply<float>(instance, entry); break;
+            case Kind::FLOAT2: apply<float2>(instance, entry); break;
+            case Kind::FLOAT3: apply<float3>(instance, entry); break;
+            case Kind::FLOAT4: apply<float4>(instance, entry); break;
+            case Kind::INT: apply<int32_t>(instance, entry); break;
+            case Kind::INT2: apply<int2>(instance, entry); break;
+            case Kind::INT3: apply<int3>(instance, entry); break;
+            case Kind::INT4: apply<int4>(instance, entry); break;
+            case Kind::MAT3F: apply<mat3f>(instance, entry); break;
+            case Kind::MAT4F: apply<mat4f>(instance, entry); break;
+        }
+    }
+}
+
+- (size_t)getCount{
+    return entries.size();
+}
+
+- (void)clear{
+    entries.clear();
+}
+
+@end
@@ -0,0 +1,130 @@
+//
+//  ReadbackPool.mm
+//
+#import "Bindings/Filament/ReadbackPool.h"
+#import "Bindings/Filament/Renderer.h"
+#import "Bindings/Filament/RenderTarget.h"
+#import <backend/CallbackHandler.h>
+#import <backend/PixelBufferDescriptor.h>
+#import <filament/Renderer.h>
+#import "../Formats.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// Dispatches Filament's buffer callbacks onto a GCD queue instead of the engine's main thread.
+class QueueCallbackHandler : public filament::backend::CallbackHandler {
+public:
+    explicit QueueCallbackHandler(dispatch_queue_t queue) : mQueue(queue) {}
+    void post(void* user, Callback callback) override {
+        dispatch_async_f(mQueue, user, callback);
+    }
+private:
+    dispatch_queue_t mQueue;
+};
+
+struct Slot {
+    std::unique_ptr<uint8_t[]> bytes;
+    size_t size = 0;
+    uint64_t tag = 0;
+    ReadbackCompletion completion;
+    // Keeps the pool alive while the slot is in flight or its pixels are held.
+    ReadbackPool* pool;
+};
+
+}
+
+@interface ReadbackPool ()
+- (void) complete: (Slot*) slot;
+- (void) recycle: (Slot*) slot;
+@end
+
+@implementation ReadbackPool{
+    std::vector<Slot> slots;
+    std::vector<Slot*> available;
+    std::mutex lock;
+    std::unique_ptr<QueueCallbackHandler> handler;
+}
+
+- (instancetype)init:(NSUInteger)bufferCount :(NSUInteger)bufferSize :(Format)format :(PixelDataType)type :(dispatch_queue_t)queue{
+    self = [super init];
+    self->_format = format;
+    self->_type = type;
+    self->_bufferSize = bufferSize;
+    self->_bufferCount = bufferCount;
+    if (queue) {
+        handler = std::make_unique<QueueCallbackHandler>(queue);
+    }
+    slots.resize(bufferCount);
+    available.reserve(bufferCount);
+    for (auto& slot : slots) {
+        slot.bytes.reset(new uint8_t[bufferSize]);
+        available.push_back(&slot);
+    }
+    return self;
+}
+
+- (NSUInteger)getAvailableCount{
+    std::lock_guard<std::mutex> guard(lock);
+    return available.size();
+}
+
+- (bool)readPixels:(Renderer *)renderer :(RenderTarget *)target :(int)xoffset :(int)yoffset :(int)width :(int)height :(uint64_t)tag :(ReadbackCompletion)completion{
+    auto const format = bindings::toNativeFormat(_format);
+    auto const type = (filament::backend::PixelDataType) _type;
+    size_t const size = filament::backend::PixelBufferDescriptor::computeDataSize(
+            format, type, width, height, 1);
+    if (size == 0 || size > _bufferSize) {
+        return false;
+    }
+
+    Slot* slot;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (available.empty()) {
+            return false;
+        }
+        slot = available.back();
+        available.pop_back();
+    }
+    slot->size = size;
+    slot->tag = tag;
+    slot->completion = completion;
+    slot->pool = self;
+
+    filament::backend::PixelBufferDescriptor buffer(slot->bytes.get(), size, format, type, 1, 0, 0, 0,
+            handler.get(), [](void*, size_t, void* user) {
+                auto slot = static_cast<Slot*>(user);
+                [slot->pool complete:slot];
+            }, slot);
+
+    auto nativeRenderer = (filament::Renderer*) renderer.renderer;
+    if (target) {
+        nativeRenderer->readPixels((filament::RenderTarget*) target.target,
+                xoffset, yoffset, width, height, std::move(buffer));
+    } else {
+        nativeRenderer->readPixels(xoffset, yoffset, width, height, std::move(buffer));
+    }
+    return true;
+}
+
+- (void)complete:(Slot *)slot{
+    ReadbackCompletion completion = slot->completion;
+    slot->completion = nil;
+    NSData* pixels = [[NSData alloc] initWithBytesNoCopy:slot->bytes.get() length:slot->size
+            deallocator:^(void*, NSUInteger) {
+        [self recycle:slot];
+    }];
+    completion(pixels, slot->tag);
+}
+
+- (void)recycle:(Slot *)slot{
+    slot->pool = nil;
+    std::lock_guard<std::mutex> guard(lock);
+    available.push_back(slot);
+}
+
+@end
@@ -5,6 +5,7 @@
 //
 #import "Bindings/Filament/RenderTargetBuilder.h"
 #import <filament/RenderTarget.h>
+#import "../Wrappers.h"
 
 @implementation RenderTargetBuilder{
     filament::RenderTarget::Builder* nativeBuilder;
@@ -33,7 +34,7 @@
 }
 
 - (nonnull RenderTarget *)build:(nonnull Engine *)engine {
-    return [[RenderTarget alloc] init:nativeBuilder->build(*(filament::Engine*) engine.engine)];
+    return bindings::wrap<RenderTarget>(nativeBuilder->build(*(filament::Engine*) engine.engine), engine.engine);
 }
 
 @end
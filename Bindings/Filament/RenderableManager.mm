@@ -8,6 +8,9 @@
 #import <filament/Box.h>
 #import <utils/Entity.h>
 #import "../Math.h"
+#import "../Wrappers.h"
+
+static_assert(sizeof(filament::RenderableManager::Bone) == 2 * sizeof(simd_float4), "Bone must be two float4 rows");
 
 @implementation RenderableManager{
     filament::RenderableManager* nativeManager;
@@ -70,7 +73,7 @@
     nativeManager->setMaterialInstanceAt(instance, primitiveIndex, (filament::MaterialInstance*) materialInstance.instance);
 }
 - (MaterialInstance *)getMaterialInstanceAt:(EntityInstance)instance :(int)primitiveIndex{
-    return [[MaterialInstance alloc] init: nativeManager->getMaterialInstanceAt(instance, primitiveIndex)];
+    return bindings::wrap<MaterialInstance>(nativeManager->getMaterialInstanceAt(instance, primitiveIndex));
 }
 - (void)setGeometryAt:(EntityInstance)instance :(int)primitiveIndex :(PrimitiveType)type :(VertexBuffer *)vertices :(IndexBuffer *)indices :(int)offset :(int)count{
     nativeManager->setGeometryAt(instance, primitiveIndex, (filament::RenderableManager::PrimitiveType) type, (filament::VertexBuffer*)vertices.buffer, (filament::IndexBuffer*)indices.buffer, offset, count);
@@ -99,7 +102,7 @@
 
 - (nullable MorphTargetBuffer *)getMorphTargetBufferAt:(EntityInstance)instance :(uint8_t)level :(size_t)primitiveIndex {
     auto buffer = nativeManager->getMorphTargetBufferAt(instance, level, primitiveIndex);
-    return [[MorphTargetBuffer alloc] init:buffer];
+    return bindings::wrap<MorphTargetBuffer>(buffer);
 }
 
 - (size_t)getMorphTargetCount:(EntityInstance)instance {
@@ -111,7 +114,11 @@
 }
 
 - (void)setBones:(EntityInstance)instance :(nonnull const simd_float4 *)transforms :(size_t)boneCount :(size_t)offset {
-#warning  Get float4 array from swift
+    nativeManager->setBones(instance, BONES_FROM_SIMD(transforms), boneCount, offset);
+}
+
+- (void)setBoneMatrices:(EntityInstance)instance :(nonnull const simd_float4x4 *)transforms :(size_t)boneCount :(size_t)offset {
+    nativeManager->setBones(instance, MAT4F_ARRAY_FROM_SIMD(transforms), boneCount, offset);
 }
 
 - (void)setChannel:(EntityInstance)instance :(uint8_t)channel {
@@ -131,7 +138,7 @@
 }
 
 - (void)setMorphWeights:(EntityInstance)instance :(nonnull const float *)weights :(size_t)count :(size_t)offset {
-#warning  Get float array from swift
+    nativeManager->setMorphWeights(instance, weights, count, offset);
 }
 
 - (void)setSkinningBuffer:(EntityInstance)instance :(nonnull SkinningBuffer *)skinningBuffer :(size_t)count :(size_t)offset {
@@ -6,7 +6,6 @@
 //
 
 #import "Bindings/Filament/Renderer.h"
-#import <backend/PixelBufferDescriptor.h>
 #import <filament/Renderer.h>
 #import <filament/Texture.h>
 #import <filament/Viewport.h>
@@ -70,15 +69,19 @@
 - (void)copyFrame:(SwapChain *)dstSwapChain :(Viewport)dstViewport :(Viewport)srcViewport :(int)flags{
     nativeRenderer->copyFrame((filament::SwapChain*) dstSwapChain.swapchain, filament::Viewport(dstViewport.left, dstViewport.bottom, dstViewport.width, dstViewport.height), filament::Viewport(srcViewport.left, srcViewport.bottom, srcViewport.width, srcViewport.height));
 }
+// The read-back only completes frames later, so there is nothing to return synchronously
+// without handing out a buffer the driver is still writing to; see readPixelsAsync.
 - (NSData *)readPixels:(int)xoffset :(int)yoffset :(int)width :(int)height{
-    auto buf = filament::backend::PixelBufferDescriptor();
-    nativeRenderer->readPixels(xoffset, yoffset, width, height, std::move(buf));
-    return [[NSData alloc] initWithBytes:buf.buffer length:buf.size];
+    return [NSData data];
 }
 - (NSData *)readPixels:(RenderTarget *)target :(int)xoffset :(int)yoffset :(int)width :(int)height{
-    auto buf = filament::backend::PixelBufferDescriptor();
-    nativeRenderer->readPixels((filament::RenderTarget*)target.target ,xoffset, yoffset, width, height, std::move(buf));
-    return [[NSData alloc] initWithBytes:buf.buffer length:buf.size];
+    return [NSData data];
+}
+- (bool)readPixelsAsync:(ReadbackPool *)pool :(int)xoffset :(int)yoffset :(int)width :(int)height :(uint64_t)tag :(ReadbackCompletion)completion{
+    return [pool readPixels:self :nil :xoffset :yoffset :width :height :tag :completion];
+}
+- (bool)readPixelsAsync:(ReadbackPool *)pool :(RenderTarget *)target :(int)xoffset :(int)yoffset :(int)width :(int)height :(uint64_t)tag :(ReadbackCompletion)completion{
+    return [pool readPixels:self :target :xoffset :yoffset :width :height :tag :completion];
 }
 
 - (double)getUserTime{
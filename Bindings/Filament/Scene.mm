@@ -9,6 +9,8 @@
 #import "Bindings/Filament/Scene.h"
 #import <filament/Scene.h>
 #import <utils/Entity.h>
+#import "../Entities.h"
+#import "../Wrappers.h"
 
 @implementation Scene{
     filament::Scene* nativeScene;
@@ -22,7 +24,7 @@
 
 - (Skybox *)getSkybox{
     auto skybox = nativeScene->getSkybox();
-    return [[Skybox alloc] init: skybox];
+    return bindings::wrap<Skybox>(skybox);
 }
 - (void)setSkybox:(Skybox *)skybox{
     nativeScene->setSkybox((filament::Skybox*) skybox.skybox);
@@ -49,7 +51,7 @@
 
 
 - (nullable IndirectLight *)getIndirectLight {
-    return [[IndirectLight alloc] init:nativeScene->getIndirectLight()];
+    return bindings::wrap<IndirectLight>(nativeScene->getIndirectLight());
 }
 
 - (void)remove:(Entity)entity {
@@ -57,19 +59,23 @@
 }
 
 - (void)removeEntities:(nonnull NSArray<NSNumber *> *)entities {
-    utils::Entity ents[entities.count];
-    for(auto i = 0; i<entities.count; i++){
-        ents[i] = utils::Entity::import(entities[i].unsignedIntValue);
-    }
-    nativeScene->removeEntities(ents, entities.count);
+    bindings::forEachEntityChunk(entities, [&](const utils::Entity* ents, size_t count) {
+        nativeScene->removeEntities(ents, count);
+    });
 }
 
 - (void)addEntities:(nonnull NSArray<NSNumber *> *)entities {
-    utils::Entity ents[entities.count];
-    for(auto i = 0; i<entities.count; i++){
-        ents[i] = utils::Entity::import(entities[i].unsignedIntValue);
-    }
-    nativeScene->addEntities(ents, entities.count);
+    bindings::forEachEntityChunk(entities, [&](const utils::Entity* ents, size_t count) {
+        nativeScene->addEntities(ents, count);
+    });
+}
+
+- (void)addEntities:(nonnull const Entity *)entities :(size_t)count {
+    nativeScene->addEntities(bindings::toNative(entities), count);
+}
+
+- (void)removeEntities:(nonnull const Entity *)entities :(size_t)count {
+    nativeScene->removeEntities(bindings::toNative(entities), count);
 }
 
 @end
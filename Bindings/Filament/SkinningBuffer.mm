@@ -5,6 +5,9 @@
 //
 #import "Bindings/Filament/SkinningBuffer.h"
 #import <filament/SkinningBuffer.h>
+#import <filament/RenderableManager.h>
+#import "Bindings/Filament/Engine.h"
+#import "../Math.h"
 
 @implementation SkinningBuffer{
     filament::SkinningBuffer* nativeBuffer;
@@ -17,8 +20,11 @@
 }
 
 - (void)setBones:(nonnull Engine *)engine :(nonnull const simd_float4 *)transforms :(size_t)count :(size_t)offset {
-#warning Bone/float4 array from swift
-//    nativeBuffer->setBones((filament::Engine*) engine.engine, (filament::RenderableManager::Bone() , count, offset);
+    nativeBuffer->setBones(*(filament::Engine*) engine.engine, BONES_FROM_SIMD(transforms), count, offset);
+}
+
+- (void)setBoneMatrices:(nonnull Engine *)engine :(nonnull const simd_float4x4 *)transforms :(size_t)count :(size_t)offset {
+    nativeBuffer->setBones(*(filament::Engine*) engine.engine, MAT4F_ARRAY_FROM_SIMD(transforms), count, offset);
 }
 
 - (size_t)getBoneCount {
@@ -6,6 +6,7 @@
 #import "Bindings/Filament/Skybox.h"
 #import <filament/Skybox.h>
 #import <math/mat4.h>
+#import "../Wrappers.h"
 
 @implementation Skybox{
     filament::Skybox* nativeSkybox;
@@ -22,7 +23,7 @@
 }
 
 - (nullable Texture *)getTexture {
-    return [[Texture alloc] init: (void*)nativeSkybox->getTexture()];
+    return bindings::wrap<Texture>(nativeSkybox->getTexture());
     
 }
 
@@ -7,6 +7,7 @@
 #import "Bindings/Filament/Engine.h"
 #import <filament/Skybox.h>
 #import <math/mat4.h>
+#import "../Wrappers.h"
 
 @implementation SkyboxBuilder{
     filament::Skybox::Builder* nativeBuilder;
@@ -39,7 +40,7 @@
 }
 
 - (nonnull Skybox *)build:(nonnull Engine *)engine {
-    return [[Skybox alloc] init:nativeBuilder->build(*(filament::Engine*) engine.engine)];
+    return bindings::wrap<Skybox>(nativeBuilder->build(*(filament::Engine*) engine.engine), engine.engine);
 }
 
 @end
@@ -7,6 +7,135 @@
 #import <filament/Texture.h>
 #import "Bindings/Filament/Engine.h"
 #import "Bindings/Filament/Stream.h"
+#import "../Buffers.h"
+#import "../Formats.h"
+#import "../Scratch.h"
+
+#include <algorithm>
+
+using filament::backend::PixelDataFormat;
+using NativeDataType = filament::backend::PixelDataType;
+using TextureFormat = filament::backend::TextureFormat;
+
+using bindings::toNativeFormat;
+using bindings::isCompressed;
+using bindings::toCompressedType;
+
+/**
+ * The layout client-side pixels are assumed to have when uploaded into a texture of the given
+ * format without a descriptor.
+ */
+static std::pair<PixelDataFormat, NativeDataType> defaultLayout(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::R8:                 return { PixelDataFormat::R, NativeDataType::UBYTE };
+        case TextureFormat::R8_SNORM:           return { PixelDataFormat::R, NativeDataType::BYTE };
+        case TextureFormat::R8UI:               return { PixelDataFormat::R_INTEGER, NativeDataType::UBYTE };
+        case TextureFormat::R8I:                return { PixelDataFormat::R_INTEGER, NativeDataType::BYTE };
+        case TextureFormat::R16F:               return { PixelDataFormat::R, NativeDataType::HALF };
+        case TextureFormat::R16UI:              return { PixelDataFormat::R_INTEGER, NativeDataType::USHORT };
+        case TextureFormat::R16I:               return { PixelDataFormat::R_INTEGER, NativeDataType::SHORT };
+        case TextureFormat::RG8:                return { PixelDataFormat::RG, NativeDataType::UBYTE };
+        case TextureFormat::RG8_SNORM:          return { PixelDataFormat::RG, NativeDataType::BYTE };
+        case TextureFormat::RG8UI:              return { PixelDataFormat::RG_INTEGER, NativeDataType::UBYTE };
+        case TextureFormat::RG8I:               return { PixelDataFormat::RG_INTEGER, NativeDataType::BYTE };
+        case TextureFormat::RGB565:             return { PixelDataFormat::RGB, NativeDataType::USHORT_565 };
+        case TextureFormat::RGB9_E5:            return { PixelDataFormat::RGB, NativeDataType::HALF };
+        case TextureFormat::DEPTH16:            return { PixelDataFormat::DEPTH_COMPONENT, NativeDataType::USHORT };
+        case TextureFormat::RGB8:
+        case TextureFormat::SRGB8:              return { PixelDataFormat::RGB, NativeDataType::UBYTE };
+        case TextureFormat::RGB8_SNORM:         return { PixelDataFormat::RGB, NativeDataType::BYTE };
+        case TextureFormat::RGB8UI:             return { PixelDataFormat::RGB_INTEGER, NativeDataType::UBYTE };
+        case TextureFormat::RGB8I:              return { PixelDataFormat::RGB_INTEGER, NativeDataType::BYTE };
+        case TextureFormat::DEPTH24:            return { PixelDataFormat::DEPTH_COMPONENT, NativeDataType::UINT };
+        case TextureFormat::R32F:               return { PixelDataFormat::R, NativeDataType::FLOAT };
+        case TextureFormat::R32UI:              return { PixelDataFormat::R_INTEGER, NativeDataType::UINT };
+        case TextureFormat::R32I:               return { PixelDataFormat::R_INTEGER, NativeDataType::INT };
+        case TextureFormat::RG16F:              return { PixelDataFormat::RG, NativeDataType::HALF };
+        case TextureFormat::RG16UI:             return { PixelDataFormat::RG_INTEGER, NativeDataType::USHORT };
+        case TextureFormat::RG16I:              return { PixelDataFormat::RG_INTEGER, NativeDataType::SHORT };
+        case TextureFormat::R11F_G11F_B10F:     return { PixelDataFormat::RGB, NativeDataType::UINT_10F_11F_11F_REV };
+        case TextureFormat::RGBA8:
+        case TextureFormat::SRGB8_A8:           return { PixelDataFormat::RGBA, NativeDataType::UBYTE };
+        case TextureFormat::RGBA8_SNORM:        return { PixelDataFormat::RGBA, NativeDataType::BYTE };
+        case TextureFormat::RGB10_A2:           return { PixelDataFormat::RGBA, NativeDataType::UINT_2_10_10_10_REV };
+        case TextureFormat::RGBA8UI:            return { PixelDataFormat::RGBA_INTEGER, NativeDataType::UBYTE };
+        case TextureFormat::RGBA8I:             return { PixelDataFormat::RGBA_INTEGER, NativeDataType::BYTE };
+        case TextureFormat::DEPTH32F:           return { PixelDataFormat::DEPTH_COMPONENT, NativeDataType::FLOAT };
+        case TextureFormat::RGB16F:             return { PixelDataFormat::RGB, NativeDataType::HALF };
+        case TextureFormat::RGB16UI:            return { PixelDataFormat::RGB_INTEGER, NativeDataType::USHORT };
+        case TextureFormat::RGB16I:             return { PixelDataFormat::RGB_INTEGER, NativeDataType::SHORT };
+        case TextureFormat::RG32F:              return { PixelDataFormat::RG, NativeDataType::FLOAT };
+        case TextureFormat::RG32UI:             return { PixelDataFormat::RG_INTEGER, NativeDataType::UINT };
+        case TextureFormat::RG32I:              return { PixelDataFormat::RG_INTEGER, NativeDataType::INT };
+        case TextureFormat::RGBA16F:            return { PixelDataFormat::RGBA, NativeDataType::HALF };
+        case TextureFormat::RGBA16UI:           return { PixelDataFormat::RGBA_INTEGER, NativeDataType::USHORT };
+        case TextureFormat::RGBA16I:            return { PixelDataFormat::RGBA_INTEGER, NativeDataType::SHORT };
+        case TextureFormat::RGB32F:             return { PixelDataFormat::RGB, NativeDataType::FLOAT };
+        case TextureFormat::RGB32UI:            return { PixelDataFormat::RGB_INTEGER, NativeDataType::UINT };
+        case TextureFormat::RGB32I:             return { PixelDataFormat::RGB_INTEGER, NativeDataType::INT };
+        case TextureFormat::RGBA32F:            return { PixelDataFormat::RGBA, NativeDataType::FLOAT };
+        case TextureFormat::RGBA32UI:           return { PixelDataFormat::RGBA_INTEGER, NativeDataType::UINT };
+        case TextureFormat::RGBA32I:            return { PixelDataFormat::RGBA_INTEGER, NativeDataType::INT };
+        default:                                return { PixelDataFormat::RGBA, NativeDataType::UBYTE };
+    }
+}
+
+static filament::Texture::FaceOffsets toFaceOffsets(simd_double2x3 faceOffset) {
+    filament::Texture::FaceOffsets offsets;
+    for (size_t i = 0; i < 6; i++) {
+        offsets[i] = (size_t) faceOffset.columns[i / 3][i % 3];
+    }
+    return offsets;
+}
+
+@interface PixelBufferDescriptor ()
+- (NSUInteger) availableLength;
+- (filament::backend::PixelBufferDescriptor) toNative: (NSUInteger) offset :(NSUInteger) length;
+@end
+
+@implementation PixelBufferDescriptor
+
+- (instancetype)initWithData:(NSData *)data :(Format)format :(PixelDataType)type{
+    self = [super init];
+    self->_data = data;
+    self->_format = format;
+    self->_type = type;
+    self->_alignment = 1;
+    return self;
+}
+- (instancetype)initWithCompressedData:(NSData *)data :(InternalFormat)compressedFormat{
+    self = [self initWithData:data :RGBA :PixelDataTypeCompressed];
+    self->_compressedFormat = compressedFormat;
+    return self;
+}
+- (NSUInteger)availableLength{
+    NSUInteger const end = _data.length;
+    NSUInteger const start = std::min(_offset, end);
+    return _length ? std::min(_length, end - start) : end - start;
+}
+// References `length` bytes starting `offset` bytes after the descriptor's own offset.
+- (filament::backend::PixelBufferDescriptor)toNative:(NSUInteger)offset :(NSUInteger)length{
+    NSUInteger const available = [self availableLength];
+    offset = std::min(offset, available);
+    length = std::min(length, available - offset);
+    if (_type == PixelDataTypeCompressed) {
+        return bindings::retainedPixelBuffer(_data, _offset + offset, length,
+                toCompressedType(_compressedFormat));
+    }
+    return bindings::retainedPixelBuffer(_data, _offset + offset, length,
+            toNativeFormat(_format), (NativeDataType) _type, _alignment, _left, _top, _stride);
+}
+@end
+
+@implementation PrefilterOptions
+
+- (instancetype)init{
+    self = [super init];
+    self->_sampleCount = 8;
+    self->_mirror = true;
+    return self;
+}
+@end
 
 @implementation Texture{
     filament::Texture* nativeTexture;
@@ -19,13 +148,13 @@
 }
 
 - (unsigned long)getWidth:(int)level{
-    return nativeTexture->getWidth();
+    return nativeTexture->getWidth(level);
 }
 - (unsigned long)getHeight:(int)level{
-    return nativeTexture->getHeight();
+    return nativeTexture->getHeight(level);
 }
-- (unsigned long)getDepth:(int)getDepth{
-    return nativeTexture->getWidth();
+- (unsigned long)getDepth:(int)level{
+    return nativeTexture->getDepth(level);
 }
 - (unsigned long)getLevels{
     return nativeTexture->getLevels();
@@ -36,15 +165,105 @@
 - (InternalFormat)getFormat{
     return (InternalFormat) nativeTexture->getFormat();
 }
+// Describes `buffer` with the natural pixel layout of this texture's format. Mutable data is
+// copied so that later changes cannot race with the upload.
+- (PixelBufferDescriptor*)describe:(NSData *)buffer{
+    NSData* data = [buffer copy];
+    auto const format = (InternalFormat) nativeTexture->getFormat();
+    if (isCompressed(format)) {
+        return [[PixelBufferDescriptor alloc] initWithCompressedData:data :format];
+    }
+    auto const layout = defaultLayout(nativeTexture->getFormat());
+    auto const pixelFormat = layout.first == PixelDataFormat::ALPHA ? ALPHA : (Format) layout.first;
+    return [[PixelBufferDescriptor alloc] initWithData:data :pixelFormat :(PixelDataType) layout.second];
+}
 - (void)setImage:(Engine *)engine :(int)level :(NSData *)buffer{
-# warning Add PixelBufferDescriptorpixelbuffer
-//    nativeTexture->setImage(*(filament::Engine*) engine.engine, level, filament::Texture::PixelBufferDescriptor(buffer.bytes, buffer.length));
+    [self setImageBuffer:engine :level :[self describe:buffer]];
 }
 - (void)setImage:(Engine *)engine :(int)level :(NSData *)buffer :(simd_double2x3)faceOffset{
+    [self setImageBuffer:engine :level :[self describe:buffer] :faceOffset];
 }
 - (void)setImage:(Engine *)engine :(int)level :(int)xoffset :(int)yoffset :(int)width :(int)height :(NSData *)buffer{
+    [self setImageBuffer:engine :level :xoffset :yoffset :width :height :[self describe:buffer]];
 }
 - (void)setImage:(Engine *)engine :(int)level :(int)xoffset :(int)yoffset :(int)zoffset :(int)width :(int)height :(int)depth :(NSData *)buffer{
+    [self setImageBuffer:engine :level :xoffset :yoffset :zoffset :width :height :depth :[self describe:buffer]];
+}
+- (void)setImageBuffer:(Engine *)engine :(int)level :(PixelBufferDescriptor *)buffer{
+    nativeTexture->setImage(*(filament::Engine*) engine.engine, level, [buffer toNative:0 :SIZE_MAX]);
+}
+- (void)setImageBuffer:(Engine *)engine :(int)level :(int)xoffset :(int)yoffset :(int)width :(int)height :(PixelBufferDescriptor *)buffer{
+    nativeTexture->setImage(*(filament::Engine*) engine.engine, level, xoffset, yoffset, width, height,
+            [buffer toNative:0 :SIZE_MAX]);
+}
+- (void)setImageBuffer:(Engine *)engine :(int)level :(int)xoffset :(int)yoffset :(int)zoffset :(int)width :(int)height :(int)depth :(PixelBufferDescriptor *)buffer{
+    nativeTexture->setImage(*(filament::Engine*) engine.engine, level, xoffset, yoffset, zoffset, width, height, depth,
+            [buffer toNative:0 :SIZE_MAX]);
+}
+- (void)setImageBuffer:(Engine *)engine :(int)level :(PixelBufferDescriptor *)buffer :(simd_double2x3)faceOffset{
+    nativeTexture->setImage(*(filament::Engine*) engine.engine, level, [buffer toNative:0 :SIZE_MAX],
+            toFaceOffsets(faceOffset));
+}
+- (bool)setMipChain:(Engine *)engine :(int)baseLevel :(PixelBufferDescriptor *)buffer :(const NSUInteger *)levelOffsets :(NSUInteger)levelCount{
+    auto& nativeEngine = *(filament::Engine*) engine.engine;
+    size_t const levels = nativeTexture->getLevels();
+    size_t const first = std::min<size_t>(std::max(baseLevel, 0), levels);
+    size_t const count = std::min<size_t>(levelCount, levels - first);
+    auto const target = nativeTexture->getTarget();
+    uint32_t const faces = target == filament::Texture::Sampler::SAMPLER_CUBEMAP ? 6 : 1;
+    NSUInteger const length = [buffer availableLength];
+    // the sizes of packed levels cannot be computed for compressed data
+    if (!levelOffsets && buffer.type == PixelDataTypeCompressed) {
+        return false;
+    }
+
+    // every level is checked against the buffer before any is uploaded, since filament would
+    // only reject a short level once the previous ones are on their way
+    bindings::ScratchScope scratch;
+    auto offsets = scratch.allocate<size_t>(count + 1);
+    offsets[0] = levelOffsets && count ? levelOffsets[0] : 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t end;
+        if (levelOffsets) {
+            end = i + 1 < count ? levelOffsets[i + 1] : length;
+        } else {
+            size_t const level = first + i;
+            uint32_t const width = (uint32_t) nativeTexture->getWidth(level);
+            uint32_t const height = (uint32_t) nativeTexture->getHeight(level);
+            uint32_t const depth = (uint32_t) nativeTexture->getDepth(
+                    target == filament::Texture::Sampler::SAMPLER_2D_ARRAY ? 0 : level);
+            end = offsets[i] + filament::backend::PixelBufferDescriptor::computeDataSize(
+                    toNativeFormat(buffer.format), (NativeDataType) buffer.type,
+                    buffer.stride ? buffer.stride : width, height, buffer.alignment) * depth * faces;
+        }
+        // the six faces of a cubemap level are assumed to have the same size
+        if (end <= offsets[i] || end > length || (end - offsets[i]) % faces != 0) {
+            return false;
+        }
+        offsets[i + 1] = end;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t const level = first + i;
+        uint32_t const width = (uint32_t) nativeTexture->getWidth(level);
+        uint32_t const height = (uint32_t) nativeTexture->getHeight(level);
+        uint32_t const depth = (uint32_t) nativeTexture->getDepth(
+                target == filament::Texture::Sampler::SAMPLER_2D_ARRAY ? 0 : level);
+        size_t const size = offsets[i + 1] - offsets[i];
+        auto descriptor = [buffer toNative:offsets[i] :size];
+        if (faces == 6) {
+            if (buffer.type == PixelDataTypeCompressed) {
+                // the compressed image size is the size of a single face
+                descriptor.imageSize = uint32_t(size / 6);
+            }
+            nativeTexture->setImage(nativeEngine, level, std::move(descriptor),
+                    filament::Texture::FaceOffsets(size / 6));
+        } else {
+            nativeTexture->setImage(nativeEngine, level, 0, 0, 0, width, height, depth,
+                    std::move(descriptor));
+        }
+    }
+    return true;
 }
 - (void)setExternalImage:(Engine *)engine :(CVPixelBufferRef)image{
     nativeTexture->setExternalImage(*(filament::Engine*) engine.engine, image);
@@ -56,7 +275,16 @@
     nativeTexture->generateMipmaps( *(filament::Engine*) engine.engine);
 }
 - (void)generatePrefilterMipmap:(Engine *)engine :(NSData *)buffer :(simd_double2x3)faceOffset :(PrefilterOptions *)options{
-# warning Add PixelBufferDescriptorpixelbuffer
-    //nativeTexture->generatePrefilterMipmap(*(filament::Engine*) engine.engine, <#PixelBufferDescriptor &&buffer#>, <#const FaceOffsets &faceOffsets#>)
+    auto descriptor = [[PixelBufferDescriptor alloc] initWithData:[buffer copy] :RGB :PixelDataTypeFloat];
+    [self generatePrefilterMipmapBuffer:engine :descriptor :faceOffset :options];
+}
+- (void)generatePrefilterMipmapBuffer:(Engine *)engine :(PixelBufferDescriptor *)buffer :(simd_double2x3)faceOffset :(PrefilterOptions *)options{
+    filament::Texture::PrefilterOptions nativeOptions;
+    if (options) {
+        nativeOptions.sampleCount = options.sampleCount;
+        nativeOptions.mirror = options.mirror;
+    }
+    nativeTexture->generatePrefilterMipmap(*(filament::Engine*) engine.engine, [buffer toNative:0 :SIZE_MAX],
+            toFaceOffsets(faceOffset), &nativeOptions);
 }
 @end
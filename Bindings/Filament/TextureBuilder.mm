@@ -5,6 +5,7 @@
 //
 #import "Bindings/Filament/TextureBuilder.h"
 #import <filament/Texture.h>
+#import "../Wrappers.h"
 
 @implementation TextureBuilder{
     filament::Texture::Builder* nativeBuilder;
@@ -57,7 +58,7 @@
 }
 - (Texture *)build:(Engine *)engine{
     auto texture = nativeBuilder->build( *(filament::Engine*)engine.engine);
-    return [[Texture alloc] init:texture];
+    return bindings::wrap<Texture>(texture, engine.engine);
 }
 - (instancetype)import:(CFTypeRef)texture{
     nativeBuilder->import((intptr_t) texture);
@@ -7,7 +7,10 @@
 #import <filament/TransformManager.h>
 #import <utils/Entity.h>
 #import <utils/EntityInstance.h>
+#import "../Kernels.h"
 #import "../Math.h"
+#import "../Scratch.h"
+#import "../Transactions.h"
 
 @implementation TransformManager{
     filament::TransformManager* nativeManager;
@@ -56,6 +59,19 @@
 - (void)setTransform:(EntityInstance)instance :(simd_double4x4)localTransform{
     nativeManager->setTransform(instance, MAT4_FROM_SIMD(localTransform));
 }
+- (void)setTransforms:(const EntityInstance *)instances :(const simd_float4x4 *)localTransforms :(size_t)count{
+    auto transforms = MAT4F_ARRAY_FROM_SIMD(localTransforms);
+    bindings::LocalTransformTransaction transaction(*nativeManager);
+    for(size_t i = 0; i<count; i++){
+        nativeManager->setTransform(instances[i], transforms[i]);
+    }
+}
+- (void)setTransformsTRS:(const EntityInstance *)instances :(const simd_float3 *)translations :(const simd_quatf *)rotations :(const simd_float3 *)scales :(size_t)count{
+    bindings::ScratchScope scratch;
+    auto transforms = scratch.allocate<simd_float4x4>(count);
+    bindings::composeTRS(translations, rotations, scales, count, transforms);
+    [self setTransforms:instances :transforms :count];
+}
 - (simd_double4x4)getTransform:(EntityInstance)instance{
     auto transform = nativeManager->getTransform(instance);
     return SIMD_DOUBLE4X4_FROM_MAT4(transform);
@@ -66,8 +82,10 @@
 }
 - (void)openLocalTransformTransaction{
     nativeManager->openLocalTransformTransaction();
+    bindings::LocalTransformTransactions::setOpen(nativeManager, true);
 }
 - (void) commitLocalTransformTransaction{
+    bindings::LocalTransformTransactions::setOpen(nativeManager, false);
     nativeManager->commitLocalTransformTransaction();
 }
 
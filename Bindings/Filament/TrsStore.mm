@@ -0,0 +1,351 @@
+//
+//  TrsStore.mm
+//
+#import "Bindings/Filament/TrsStore.h"
+#import "Bindings/Filament/EntityManager.h"
+#import "Bindings/Filament/TransformManager.h"
+#import <filament/TransformManager.h>
+#import <utils/Entity.h>
+#import <utils/EntityManager.h>
+#import <utils/SingleInstanceComponentManager.h>
+#import "../Kernels.h"
+#import "../Math.h"
+#import "../Transactions.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+namespace {
+
+using bindings::POSE_COMPONENTS;
+using Clock = std::chrono::steady_clock;
+
+// Destroyed entities are taken from the queue and collected this many at a time, between
+// checks of the budget.
+constexpr size_t COLLECT_BATCH_SIZE = 64;
+
+/**
+ * The components of the store, one array per coordinate in the order of the pose kernels,
+ * followed by the dirty flags, which move along with their component when another one is
+ * removed.
+ */
+class Store : public utils::SingleInstanceComponentManager<
+        float, float, float,
+        float, float, float, float,
+        float, float, float,
+        uint8_t> {
+public:
+    static constexpr size_t DIRTY = POSE_COMPONENTS;
+
+    Instance create(utils::Entity entity, simd_float3 t, simd_quatf r, simd_float3 s) {
+        Instance const i = addComponent(entity);
+        set(i, t, r, s);
+        return i;
+    }
+
+    /** Creates an identity component, leaving an existing one untouched. */
+    Instance create(utils::Entity entity) {
+        if (Instance const i = getInstance(entity)) {
+            return i;
+        }
+        return create(entity, simd_make_float3(0, 0, 0), simd_quaternion(0.0f, 0.0f, 0.0f, 1.0f),
+                simd_make_float3(1, 1, 1));
+    }
+
+    void destroy(utils::Entity entity) {
+        Instance const i = getInstance(entity);
+        if (i && elementAt<DIRTY>(i)) {
+            mDirtyCount--;
+        }
+        removeComponent(entity);
+    }
+
+    void gc(utils::EntityManager const& em) {
+        SingleInstanceComponentManager::gc(em, [this](utils::Entity e) {
+            destroy(e);
+        });
+    }
+
+    void setTranslation(Instance i, simd_float3 t) {
+        componentData(0)[i] = t.x;
+        componentData(1)[i] = t.y;
+        componentData(2)[i] = t.z;
+        markDirty(i);
+    }
+
+    void setRotation(Instance i, simd_quatf r) {
+        componentData(3)[i] = r.vector.x;
+        componentData(4)[i] = r.vector.y;
+        componentData(5)[i] = r.vector.z;
+        componentData(6)[i] = r.vector.w;
+        markDirty(i);
+    }
+
+    void setScale(Instance i, simd_float3 s) {
+        componentData(7)[i] = s.x;
+        componentData(8)[i] = s.y;
+        componentData(9)[i] = s.z;
+        markDirty(i);
+    }
+
+    void set(Instance i, simd_float3 t, simd_quatf r, simd_float3 s) {
+        setTranslation(i, t);
+        setRotation(i, r);
+        setScale(i, s);
+    }
+
+    simd_float3 getTranslation(Instance i) {
+        return simd_make_float3(componentData(0)[i], componentData(1)[i], componentData(2)[i]);
+    }
+
+    simd_quatf getRotation(Instance i) {
+        return simd_quaternion(componentData(3)[i], componentData(4)[i], componentData(5)[i], componentData(6)[i]);
+    }
+
+    simd_float3 getScale(Instance i) {
+        return simd_make_float3(componentData(7)[i], componentData(8)[i], componentData(9)[i]);
+    }
+
+    size_t getDirtyCount() const noexcept {
+        return mDirtyCount;
+    }
+
+    /**
+     * Composes the transforms of the dirty components, eight components at a time, and sets
+     * them in a single transaction.
+     */
+    size_t flush(filament::TransformManager& tm) {
+        if (mDirtyCount == 0) {
+            return 0;
+        }
+        size_t const count = getComponentCount();
+        const float* components[POSE_COMPONENTS];
+        for (size_t c = 0; c < POSE_COMPONENTS; c++) {
+            components[c] = componentData(c) + 1;
+        }
+        uint8_t* const dirty = data<DIRTY>() + 1;
+        utils::Entity const* const entities = getEntities();
+        simd_float4x4 transforms[8];
+        size_t set = 0;
+        bindings::LocalTransformTransaction transaction(tm);
+        for (size_t first = 0; first < count; first += 8) {
+            size_t const n = std::min(count - first, size_t(8));
+            uint64_t flags = 0;
+            std::memcpy(&flags, dirty + first, n);
+            if (flags == 0) {
+                continue;
+            }
+            const float* block[POSE_COMPONENTS];
+            for (size_t c = 0; c < POSE_COMPONENTS; c++) {
+                block[c] = components[c] + first;
+            }
+            bindings::composePoses(block, n, transforms);
+            for (size_t k = 0; k < n; k++) {
+                if (dirty[first + k]) {
+                    dirty[first + k] = 0;
+                    auto const ti = tm.getInstance(entities[first + k]);
+                    if (ti) {
+                        tm.setTransform(ti, MAT4F_ARRAY_FROM_SIMD(transforms)[k]);
+                        set++;
+                    }
+                }
+            }
+        }
+        mDirtyCount = 0;
+        return set;
+    }
+
+private:
+    // the arrays of the coordinates, which SoA only indexes at compile time
+    float* componentData(size_t c) noexcept {
+        switch (c) {
+            case 0: return data<0>();
+            case 1: return data<1>();
+            case 2: return data<2>();
+            case 3: return data<3>();
+            case 4: return data<4>();
+            case 5: return data<5>();
+            case 6: return data<6>();
+            case 7: return data<7>();
+            case 8: return data<8>();
+            default: return data<9>();
+        }
+    }
+
+    void markDirty(Instance i) {
+        uint8_t& dirty = elementAt<DIRTY>(i);
+        mDirtyCount += !dirty;
+        dirty = 1;
+    }
+
+    size_t mDirtyCount = 0;
+};
+
+/**
+ * Queues the entities destroyed by an EntityManager, which notifies it on the thread that
+ * destroys them.
+ */
+class DestroyedQueue : public utils::EntityManager::Listener {
+public:
+    void onEntitiesDestroyed(size_t n, utils::Entity const* entities) noexcept override {
+        std::lock_guard<std::mutex> guard(mLock);
+        mPending.insert(mPending.end(), entities, entities + n);
+    }
+
+    /** Moves up to `count` of the oldest entities to `out` and returns how many. */
+    size_t take(size_t count, utils::Entity* out) {
+        std::lock_guard<std::mutex> guard(mLock);
+        count = std::min(count, mPending.size());
+        std::copy_n(mPending.begin(), count, out);
+        mPending.erase(mPending.begin(), mPending.begin() + count);
+        return count;
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> guard(mLock);
+        return mPending.size();
+    }
+
+private:
+    std::mutex mLock;
+    std::deque<utils::Entity> mPending;
+};
+
+}
+
+@implementation TrsStore{
+    Store store;
+    DestroyedQueue destroyed;
+    utils::EntityManager* entityManager;
+    uint64_t collectedCount;
+}
+
+- (instancetype)init{
+    self = [super init];
+    entityManager = nullptr;
+    collectedCount = 0;
+    return self;
+}
+
+- (instancetype)init:(EntityManager *)manager{
+    self = [self init];
+    entityManager = (utils::EntityManager*) manager.manager;
+    entityManager->registerListener(&destroyed);
+    return self;
+}
+
+- (void)dealloc{
+    if (entityManager) {
+        entityManager->unregisterListener(&destroyed);
+    }
+}
+
+- (bool)hasComponent:(Entity)entity{
+    return store.hasComponent(utils::Entity::import(entity));
+}
+
+- (EntityInstance)getInstance:(Entity)entity{
+    return store.getInstance(utils::Entity::import(entity));
+}
+
+- (size_t)getComponentCount{
+    return store.getComponentCount();
+}
+
+- (EntityInstance)create:(Entity)entity{
+    return store.create(utils::Entity::import(entity));
+}
+
+- (EntityInstance)create:(Entity)entity :(simd_float3)translation :(simd_quatf)rotation :(simd_float3)scale{
+    return store.create(utils::Entity::import(entity), translation, rotation, scale);
+}
+
+- (void)destroy:(Entity)entity{
+    store.destroy(utils::Entity::import(entity));
+}
+
+- (void)gc:(EntityManager *)manager{
+    store.gc(*(utils::EntityManager*) manager.manager);
+}
+
+- (size_t)collect:(NSTimeInterval)budget :(size_t)maxCount{
+    auto const deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(budget));
+    size_t const limit = maxCount ? maxCount : SIZE_MAX;
+    utils::Entity batch[COLLECT_BATCH_SIZE];
+    size_t processed = 0;
+    size_t collected = 0;
+    while (processed < limit && (budget <= 0 || Clock::now() < deadline)) {
+        size_t const n = destroyed.take(std::min(limit - processed, COLLECT_BATCH_SIZE), batch);
+        if (n == 0) {
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (store.hasComponent(batch[i])) {
+                store.destroy(batch[i]);
+                collected++;
+            }
+        }
+        processed += n;
+    }
+    collectedCount += collected;
+    return collected;
+}
+
+- (size_t)getPendingCount{
+    return destroyed.size();
+}
+
+- (uint64_t)getCollectedCount{
+    return collectedCount;
+}
+
+- (void)setTranslation:(EntityInstance)instance :(simd_float3)translation{
+    store.setTranslation(instance, translation);
+}
+
+- (void)setRotation:(EntityInstance)instance :(simd_quatf)rotation{
+    store.setRotation(instance, rotation);
+}
+
+- (void)setScale:(EntityInstance)instance :(simd_float3)scale{
+    store.setScale(instance, scale);
+}
+
+- (void)setTrs:(EntityInstance)instance :(simd_float3)translation :(simd_quatf)rotation :(simd_float3)scale{
+    store.set(instance, translation, rotation, scale);
+}
+
+- (void)setTrs:(const EntityInstance *)instances :(const simd_float3 *)translations :(const simd_quatf *)rotations :(const simd_float3 *)scales :(size_t)count{
+    for (size_t i = 0; i < count; i++) {
+        store.set(instances[i], translations[i], rotations[i], scales[i]);
+    }
+}
+
+- (simd_float3)getTranslation:(EntityInstance)instance{
+    return store.getTranslation(instance);
+}
+
+- (simd_quatf)getRotation:(EntityInstance)instance{
+    return store.getRotation(instance);
+}
+
+- (simd_float3)getScale:(EntityInstance)instance{
+    return store.getScale(instance);
+}
+
+- (simd_float4x4)getTransform:(EntityInstance)instance{
+    return bindings::composeTRS(store.getTranslation(instance), store.getRotation(instance), store.getScale(instance));
+}
+
+- (size_t)getDirtyCount{
+    return store.getDirtyCount();
+}
+
+- (size_t)flush:(TransformManager *)manager{
+    return store.flush(*(filament::TransformManager*) manager.manager);
+}
+
+@end
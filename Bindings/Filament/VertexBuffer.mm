@@ -6,6 +6,7 @@
 #import "Bindings/Filament/VertexBuffer.h"
 #import <filament/VertexBuffer.h>
 #import "Bindings/Filament/Engine.h"
+#import "../Buffers.h"
 
 @implementation VertexBuffer{
     filament::VertexBuffer* nativeBuffer;
@@ -20,17 +21,16 @@
     return nativeBuffer->getVertexCount();
 }
 - (void)setBufferAt:(Engine *)engine :(int)bufferIndex :(NSData *)data :(int)byteOffset{
-    const auto deleter = [](void* buffer, size_t size, void* user) {
-        delete (uint8_t*) buffer;
-    };
-    auto start = (uint8_t*) data.bytes;
-    auto bytes = new uint8_t[data.length];
-    std::copy(start, start+data.length, bytes);
-    
-    nativeBuffer->setBufferAt( *(filament::Engine*) engine.engine, bufferIndex, filament::backend::BufferDescriptor(bytes, data.length, deleter), byteOffset);
+    nativeBuffer->setBufferAt( *(filament::Engine*) engine.engine, bufferIndex, bindings::copiedBuffer(data), byteOffset);
+}
+- (void)setBufferAtNoCopy:(Engine *)engine :(int)bufferIndex :(NSData *)data :(int)byteOffset{
+    nativeBuffer->setBufferAt( *(filament::Engine*) engine.engine, bufferIndex, bindings::retainedBuffer(data), byteOffset);
 }
 - (void)setBufferAt:(Engine *)engine :(int)bufferIndex :(NSData *)data{
     [self setBufferAt:engine :bufferIndex :data :0];
 }
+- (void)setBufferAtNoCopy:(Engine *)engine :(int)bufferIndex :(NSData *)data{
+    [self setBufferAtNoCopy:engine :bufferIndex :data :0];
+}
 
 @end
@@ -9,6 +9,7 @@
 #import <filament/View.h>
 #import <filament/Viewport.h>
 #import <simd/simd.h>
+#import "../Wrappers.h"
 
 @implementation View{
     filament::View* nativeView;
@@ -27,13 +28,13 @@
     nativeView->setScene((filament::Scene*) scene.scene);
 }
 - (Scene *)getScene{
-    return [[Scene alloc] init: nativeView->getScene()];
+    return bindings::wrap<Scene>(nativeView->getScene());
 }
 - (void)setCamera:(Camera *)camera{
     nativeView->setCamera((filament::Camera*) camera.camera);
 }
 - (Camera *)getCamera{
-    return [[Camera alloc] init: &nativeView->getCamera()];
+    return bindings::wrap<Camera>(&nativeView->getCamera());
 }
 - (void)setViewport:(Viewport)viewport{
     nativeView->setViewport(filament::Viewport(viewport.left, viewport.bottom, viewport.width, viewport.height));
@@ -73,7 +74,7 @@
     nativeView->setRenderTarget((filament::RenderTarget*) target.target);
 }
 - (RenderTarget *)getRenderTarget{
-    return [[RenderTarget alloc] init: nativeView->getRenderTarget()];
+    return bindings::wrap<RenderTarget>(nativeView->getRenderTarget());
 }
 - (void)setAntiAliasing:(AntiAliasing)type{
     nativeView->setAntiAliasing((filament::View::AntiAliasing) type);
@@ -195,7 +196,7 @@
 }
 
 - (nonnull ColorGrading *)getColorGrading {
-    return [[ColorGrading alloc] init:(void*)nativeView->getColorGrading()];
+    return bindings::wrap<ColorGrading>(nativeView->getColorGrading());
 }
 
 - (DepthOfFieldOptions)getDepthOfFieldOptions {
@@ -217,7 +218,7 @@
 }
 
 - (nonnull Camera *)getDirectionalShadowCamera {
-    return [[Camera alloc] init:(void*)nativeView->getDirectionalShadowCamera()];
+    return bindings::wrap<Camera>(nativeView->getDirectionalShadowCamera());
 }
 
 - (Dithering)getDithering {
@@ -0,0 +1,32 @@
+//
+//  Formats.h
+//
+//  Conversions between the bindings' pixel enums and Filament's.
+//
+
+#ifndef Formats_h
+#define Formats_h
+
+#import "Bindings/Filament/Texture.h"
+#import <backend/DriverEnums.h>
+
+namespace bindings {
+
+// The bindings' Format has an extra STENCIL_INDEX entry before ALPHA.
+inline filament::backend::PixelDataFormat toNativeFormat(Format format) {
+    return format == ALPHA ? filament::backend::PixelDataFormat::ALPHA
+            : (filament::backend::PixelDataFormat) format;
+}
+
+inline bool isCompressed(InternalFormat format) {
+    return format >= EAC_R11;
+}
+
+// InternalFormat lists the compressed formats in the same order as CompressedPixelDataType.
+inline filament::backend::CompressedPixelDataType toCompressedType(InternalFormat format) {
+    return (filament::backend::CompressedPixelDataType) (format - EAC_R11);
+}
+
+}
+
+#endif /* Formats_h */
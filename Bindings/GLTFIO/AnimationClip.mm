@@ -0,0 +1,217 @@
+//
+//  AnimationClip.mm
+//
+#import "Bindings/GLTFIO/AnimationClip.h"
+#import <filament/TransformManager.h>
+#import <gltfio/Animator.h>
+#import <gltfio/FilamentAsset.h>
+#import <gltfio/FilamentInstance.h>
+#import "../Kernels.h"
+#import "../Math.h"
+#import "../Scratch.h"
+#import "../Transactions.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using bindings::POSE_COMPONENTS;
+
+// Instances are sampled in parallel once they have this many targets in total.
+constexpr size_t PARALLEL_MIN_TARGETS = 1024;
+
+/** The translation, rotation and scale of a glTF node's local transform. */
+void decompose(filament::math::mat4f const& m, float* pose, size_t stride, size_t i, simd_quatf previous) {
+    simd_float3 c[3];
+    float s[3];
+    for (int k = 0; k < 3; k++) {
+        c[k] = simd_make_float3(m[k][0], m[k][1], m[k][2]);
+        s[k] = simd_length(c[k]);
+    }
+    if (simd_dot(c[0], simd_cross(c[1], c[2])) < 0) {
+        s[0] = -s[0];
+    }
+    simd_quatf q = simd_quaternion(simd_matrix(c[0] / (s[0] ? s[0] : 1.0f),
+            c[1] / (s[1] ? s[1] : 1.0f), c[2] / (s[2] ? s[2] : 1.0f)));
+    // stay on the hemisphere of the previous pose so that neighbours interpolate directly
+    if (simd_dot(q.vector, previous.vector) < 0) {
+        q.vector = -q.vector;
+    }
+    float const components[POSE_COMPONENTS] = {
+        m[3][0], m[3][1], m[3][2],
+        q.vector.x, q.vector.y, q.vector.z, q.vector.w,
+        s[0], s[1], s[2]
+    };
+    for (size_t k = 0; k < POSE_COMPONENTS; k++) {
+        pose[k * stride + i] = components[k];
+    }
+}
+
+}
+
+@implementation AnimationClip{
+    // poseCount poses of the targets, each of POSE_COMPONENTS arrays of targets.size() floats
+    std::vector<float> poses;
+    std::vector<uint32_t> targets;
+    size_t entityCount;
+    size_t poseCount;
+    double duration;
+}
+
+- (instancetype)init:(FilamentInstance *)instance :(int)animationIndex :(double)sampleRate{
+    auto native = (filament::gltfio::FilamentInstance*) instance.instance;
+    auto animator = native->getAnimator();
+    if (animationIndex < 0 || animationIndex >= animator->getAnimationCount()) {
+        return nil;
+    }
+    self = [super init];
+    auto& tm = native->getAsset()->getEngine()->getTransformManager();
+    auto const entities = native->getEntities();
+    entityCount = native->getEntityCount();
+    duration = animator->getAnimationDuration(animationIndex);
+    poseCount = duration > 0 ? size_t(std::ceil(duration * std::max(sampleRate, 1.0 / duration))) + 1 : 1;
+
+    bindings::ScratchScope scratch;
+    auto instances = scratch.allocate<filament::TransformManager::Instance>(entityCount);
+    auto rest = scratch.allocate<filament::math::mat4f>(entityCount);
+    for (size_t i = 0; i < entityCount; i++) {
+        instances[i] = tm.getInstance(entities[i]);
+        rest[i] = instances[i] ? tm.getTransform(instances[i]) : filament::math::mat4f();
+    }
+    auto baked = scratch.allocate<filament::math::mat4f>(poseCount * entityCount);
+    for (size_t p = 0; p < poseCount; p++) {
+        // the animation wraps around at its duration, so the last pose is taken just before
+        double const time = p + 1 < poseCount ? p * duration / (poseCount - 1) : std::nextafter(duration, 0.0);
+        animator->applyAnimation(animationIndex, time);
+        for (size_t i = 0; i < entityCount; i++) {
+            if (instances[i]) {
+                baked[p * entityCount + i] = tm.getTransform(instances[i]);
+            }
+        }
+    }
+    {
+        bindings::LocalTransformTransaction transaction(tm);
+        for (size_t i = 0; i < entityCount; i++) {
+            if (instances[i]) {
+                tm.setTransform(instances[i], rest[i]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < entityCount; i++) {
+        for (size_t p = 0; instances[i] && p < poseCount; p++) {
+            if (std::memcmp(&baked[p * entityCount + i], &rest[i], sizeof(filament::math::mat4f)) != 0) {
+                targets.push_back(uint32_t(i));
+                break;
+            }
+        }
+    }
+    size_t const stride = targets.size();
+    poses.resize(poseCount * POSE_COMPONENTS * stride);
+    for (size_t t = 0; t < stride; t++) {
+        simd_quatf previous = simd_quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+        for (size_t p = 0; p < poseCount; p++) {
+            float* pose = poses.data() + p * POSE_COMPONENTS * stride;
+            decompose(baked[p * entityCount + targets[t]], pose, stride, t, previous);
+            previous = simd_quaternion(pose[3 * stride + t], pose[4 * stride + t],
+                    pose[5 * stride + t], pose[6 * stride + t]);
+        }
+    }
+    return self;
+}
+
+- (double)getDuration{
+    return duration;
+}
+
+- (size_t)getPoseCount{
+    return poseCount;
+}
+
+- (size_t)getTargetCount{
+    return targets.size();
+}
+
+- (const uint32_t *)getTargetIndices{
+    return targets.data();
+}
+
+/** Interpolates the pose at `time` into `result`, laid out like the baked poses. */
+- (void)samplePose:(double)time :(float *)result{
+    size_t const stride = targets.size();
+    size_t first = 0;
+    float t = 0;
+    if (poseCount > 1) {
+        double const position = std::fmod(time, duration);
+        double const index = (position < 0 ? position + duration : position) * (poseCount - 1) / duration;
+        first = std::min(size_t(index), poseCount - 2);
+        t = float(index - first);
+    }
+    const float* a = poses.data() + first * POSE_COMPONENTS * stride;
+    const float* b = poseCount > 1 ? a + POSE_COMPONENTS * stride : a;
+    bindings::interpolatePoses(a, b, stride, stride, t, !_nlerp, result);
+}
+
+- (void)sample:(double)time :(simd_float3 *)translations :(simd_quatf *)rotations :(simd_float3 *)scales{
+    size_t const stride = targets.size();
+    bindings::ScratchScope scratch;
+    auto pose = scratch.allocate<float>(POSE_COMPONENTS * stride);
+    [self samplePose:time :pose];
+    for (size_t i = 0; i < stride; i++) {
+        auto const c = [=](size_t k) { return pose[k * stride + i]; };
+        translations[i] = simd_make_float3(c(0), c(1), c(2));
+        rotations[i] = simd_quaternion(c(3), c(4), c(5), c(6));
+        scales[i] = simd_make_float3(c(7), c(8), c(9));
+    }
+}
+
+- (void)apply:(FilamentInstance *)instance :(double)time{
+    [self applyAll:@[instance] :&time];
+}
+
+- (void)applyAll:(NSArray<FilamentInstance *> *)instances :(const double *)times{
+    size_t const count = instances.count;
+    size_t const stride = targets.size();
+    if (count == 0 || stride == 0) {
+        return;
+    }
+    bindings::ScratchScope scratch;
+    auto natives = scratch.allocate<filament::gltfio::FilamentInstance*>(count);
+    for (size_t i = 0; i < count; i++) {
+        natives[i] = (filament::gltfio::FilamentInstance*) instances[i].instance;
+    }
+    auto pose = scratch.allocate<float>(count * POSE_COMPONENTS * stride);
+    auto transforms = scratch.allocate<simd_float4x4>(count * stride);
+    void (^sampleOne)(size_t) = ^(size_t i) {
+        float* p = pose + i * POSE_COMPONENTS * stride;
+        [self samplePose:times[i] :p];
+        bindings::composePoses(p, stride, stride, transforms + i * stride);
+    };
+    if (count > 1 && count * stride >= PARALLEL_MIN_TARGETS) {
+        dispatch_apply(count, DISPATCH_APPLY_AUTO, sampleOne);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            sampleOne(i);
+        }
+    }
+
+    auto& tm = natives[0]->getAsset()->getEngine()->getTransformManager();
+    auto const locals = MAT4F_ARRAY_FROM_SIMD(transforms);
+    bindings::LocalTransformTransaction transaction(tm);
+    for (size_t i = 0; i < count; i++) {
+        if (natives[i]->getEntityCount() != entityCount) {
+            continue;
+        }
+        auto const entities = natives[i]->getEntities();
+        for (size_t t = 0; t < stride; t++) {
+            auto const ti = tm.getInstance(entities[targets[t]]);
+            if (ti) {
+                tm.setTransform(ti, locals[i * stride + t]);
+            }
+        }
+    }
+}
+
+@end
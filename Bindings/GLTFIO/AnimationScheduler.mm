@@ -0,0 +1,202 @@
+//
+//  AnimationScheduler.mm
+//
+#import "Bindings/GLTFIO/AnimationScheduler.h"
+#import "Bindings/Filament/Camera.h"
+#import <filament/Box.h>
+#import <filament/Camera.h>
+#import <filament/Engine.h>
+#import <filament/Frustum.h>
+#import <filament/TransformManager.h>
+#import <gltfio/Animator.h>
+#import <gltfio/FilamentAsset.h>
+#import <gltfio/FilamentInstance.h>
+#import "../Kernels.h"
+#import "../Math.h"
+#import "../Scratch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Scheduled {
+    FilamentInstance* object;
+    filament::gltfio::FilamentInstance* instance;
+    // nil to play animationIndex with the Animator
+    AnimationClip* clip;
+    int animationIndex;
+    double timeOffset;
+    // bounding box relative to the root
+    Box bounds;
+    uint64_t lastFrame;
+};
+
+struct Due {
+    size_t index;
+    uint64_t overdue;
+};
+
+}
+
+@implementation AnimationScheduler{
+    std::vector<Scheduled> scheduled;
+    uint64_t frame;
+    size_t evaluatedCount;
+    size_t culledCount;
+    size_t throttledCount;
+    size_t deferredCount;
+    NSTimeInterval updateTime;
+}
+
+- (instancetype)init{
+    self = [super init];
+    _budget = 0.002;
+    _fullRateSize = 0.25f;
+    _maxInterval = 8;
+    _boundsScale = 1.5f;
+    // instances that were never updated are due on the first frame
+    frame = std::numeric_limits<uint32_t>::max();
+    evaluatedCount = culledCount = throttledCount = deferredCount = 0;
+    updateTime = 0;
+    return self;
+}
+
+- (void)add:(FilamentInstance *)instance :(AnimationClip *)clip :(int)animationIndex :(double)timeOffset{
+    auto native = (filament::gltfio::FilamentInstance*) instance.instance;
+    auto const box = native->getBoundingBox();
+    scheduled.push_back({ instance, native, clip, animationIndex, timeOffset, {
+        simd_make_float3(box.min.x + box.max.x, box.min.y + box.max.y, box.min.z + box.max.z) * 0.5f,
+        simd_make_float3(box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z) * 0.5f
+    }, 0 });
+}
+
+- (void)add:(FilamentInstance *)instance :(int)animationIndex :(double)timeOffset{
+    [self add:instance :nil :animationIndex :timeOffset];
+}
+
+- (void)addClip:(FilamentInstance *)instance :(AnimationClip *)clip :(double)timeOffset{
+    [self add:instance :clip :0 :timeOffset];
+}
+
+- (void)remove:(FilamentInstance *)instance{
+    auto const native = (filament::gltfio::FilamentInstance*) instance.instance;
+    scheduled.erase(std::remove_if(scheduled.begin(), scheduled.end(), [native](Scheduled const& s) {
+        return s.instance == native;
+    }), scheduled.end());
+}
+
+- (void)update:(Camera *)camera :(double)time{
+    auto const start = Clock::now();
+    frame++;
+    evaluatedCount = culledCount = throttledCount = deferredCount = 0;
+    size_t const count = scheduled.size();
+    if (count == 0) {
+        updateTime = 0;
+        return;
+    }
+
+    auto const nativeCamera = (filament::Camera*) camera.camera;
+    filament::Frustum const frustum(filament::math::mat4f(nativeCamera->getCullingProjectionMatrix() * nativeCamera->getViewMatrix()));
+    auto const projection = nativeCamera->getProjectionMatrix();
+    auto const position = nativeCamera->getPosition();
+    simd_float3 const eye = simd_make_float3(position.x, position.y, position.z);
+    // the height of the viewport is 2 / projection[1][1] at unit distance, or at any distance
+    // for orthographic projections
+    float const heightScale = float(projection[1][1]);
+    bool const perspective = projection[3][3] == 0;
+
+    auto& tm = scheduled.front().instance->getAsset()->getEngine()->getTransformManager();
+    bindings::ScratchScope scratch;
+    auto matrices = scratch.allocate<simd_float4x4>(count);
+    auto boxes = scratch.allocate<Box>(count);
+    for (size_t i = 0; i < count; i++) {
+        auto const& s = scheduled[i];
+        auto const ti = tm.getInstance(s.instance->getRoot());
+        if (ti) {
+            std::memcpy(&matrices[i], &tm.getWorldTransform(ti), sizeof(simd_float4x4));
+        } else {
+            matrices[i] = matrix_identity_float4x4;
+        }
+        boxes[i] = { s.bounds.center, s.bounds.halfExtent * _boundsScale };
+    }
+    bindings::transformBoxes(matrices, boxes, count, boxes);
+
+    auto due = scratch.allocate<Due>(count);
+    size_t dueCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        Box const& box = boxes[i];
+        if (!frustum.intersects(FROM_BOX(box))) {
+            culledCount++;
+            continue;
+        }
+        float const radius = simd_length(box.halfExtent);
+        float const distance = perspective ? std::max(simd_distance(box.center, eye), 1e-3f) : 1.0f;
+        float const size = radius * heightScale / distance;
+        uint32_t interval = 1;
+        while (interval < _maxInterval && size * interval < _fullRateSize) {
+            interval *= 2;
+        }
+        uint64_t const waited = frame - scheduled[i].lastFrame;
+        if (waited < interval) {
+            throttledCount++;
+            continue;
+        }
+        due[dueCount++] = { i, waited - interval };
+    }
+    // the instances that have waited the longest past their interval go first
+    std::stable_sort(due, due + dueCount, [](Due const& a, Due const& b) {
+        return a.overdue > b.overdue;
+    });
+
+    auto const budget = std::chrono::duration<double>(_budget);
+    for (size_t k = 0; k < dueCount; k++) {
+        if (k > 0 && Clock::now() - start >= budget) {
+            deferredCount = dueCount - k;
+            break;
+        }
+        auto& s = scheduled[due[k].index];
+        double const t = time + s.timeOffset;
+        auto const animator = s.instance->getAnimator();
+        if (s.clip) {
+            [s.clip apply:s.object :t];
+        } else {
+            animator->applyAnimation(s.animationIndex, t);
+        }
+        animator->updateBoneMatrices();
+        s.lastFrame = frame;
+        evaluatedCount++;
+    }
+    updateTime = std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+- (size_t)getInstanceCount{
+    return scheduled.size();
+}
+
+- (size_t)getEvaluatedCount{
+    return evaluatedCount;
+}
+
+- (size_t)getCulledCount{
+    return culledCount;
+}
+
+- (size_t)getThrottledCount{
+    return throttledCount;
+}
+
+- (size_t)getDeferredCount{
+    return deferredCount;
+}
+
+- (NSTimeInterval)getUpdateTime{
+    return updateTime;
+}
+
+@end
@@ -5,6 +5,9 @@
 //
 #import "Bindings/GLTFIO/AssetLoader.h"
 #import <gltfio/AssetLoader.h>
+#import "Bindings/GLTFIO/InstancePool.h"
+#import "../Scratch.h"
+#import "../Wrappers.h"
 
 @implementation Configuration
 
@@ -33,38 +36,62 @@
 
 - (FilamentAsset *)createAsset:(NSData*)bytes{
     auto asset = nativeLoader->createAsset((uint8_t*)bytes.bytes, (uint32_t)bytes.length);
-    return [[FilamentAsset alloc] init:asset];
+    return bindings::wrap<FilamentAsset>(asset);
 }
 
 
 - (FilamentInstance *)createInstance:(FilamentAsset *)primary{
     auto instance = nativeLoader->createInstance((filament::gltfio::FilamentAsset*) primary.asset);
-    return [[FilamentInstance alloc] init: instance];
+    return bindings::wrap<FilamentInstance>(instance, primary.asset);
 }
 - (FilamentAsset *)createInstancedAsset:(NSArray *)bytes :(NSMutableArray<FilamentInstance *> *)instances{
     auto count = [bytes count];
-    auto cppbytes = new UInt8[count];
+    bindings::ScratchScope scratch;
+    auto cppbytes = scratch.allocate<uint8_t>(count);
     
     auto i = 0;
     
     for(NSNumber* byte in bytes){
         cppbytes[i++] = [byte unsignedIntValue];
     }
-    auto numInstances = [instances count];
-    auto cppInstances = new filament::gltfio::FilamentInstance*[numInstances];
-    
-    auto asset = nativeLoader->createInstancedAsset(cppbytes, (uint32_t)count, cppInstances, numInstances);
-    delete[] cppbytes;
-    
-    for(auto j = 0; j<numInstances; j++){
-        auto instance = cppInstances[j];
-        [instances addObject:[[FilamentInstance alloc] init:instance]];
+    return [self createInstancedAsset:cppbytes :count :[instances count] :instances];
+}
+- (FilamentAsset *)createInstancedAsset:(NSData *)bytes :(size_t)instanceCount :(NSMutableArray<FilamentInstance *> *)instances{
+    return [self createInstancedAsset:(const uint8_t*) bytes.bytes :bytes.length :instanceCount :instances];
+}
+- (FilamentAsset *)createInstancedAsset:(const uint8_t *)bytes :(size_t)length :(size_t)instanceCount :(NSMutableArray<FilamentInstance *> *)instances{
+    bindings::ScratchScope scratch;
+    auto cppInstances = scratch.allocate<filament::gltfio::FilamentInstance*>(instanceCount);
+    auto asset = nativeLoader->createInstancedAsset(bytes, (uint32_t) length, cppInstances, instanceCount);
+    if (!asset) {
+        return nil;
     }
-    
-    return [[FilamentAsset alloc] init:asset];
+    for(size_t j = 0; j<instanceCount; j++){
+        [instances addObject:bindings::wrap<FilamentInstance>(cppInstances[j], asset)];
+    }
+    return bindings::wrap<FilamentAsset>(asset);
+}
+- (FilamentAsset *)createInstancedAssetFromFile:(NSString *)path :(size_t)instanceCount :(NSMutableArray<FilamentInstance *> *)instances{
+    // gltfio keeps its own copy of the source, so the mapping only lives for the call
+    NSData* bytes = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:nil];
+    if (!bytes) {
+        return nil;
+    }
+    return [self createInstancedAsset:bytes :instanceCount :instances];
+}
+- (InstancePool *)createInstancePool:(NSData *)bytes :(size_t)capacity{
+    bindings::ScratchScope scratch;
+    auto cppInstances = scratch.allocate<filament::gltfio::FilamentInstance*>(capacity);
+    auto asset = nativeLoader->createInstancedAsset((const uint8_t*) bytes.bytes, (uint32_t) bytes.length,
+            cppInstances, capacity);
+    if (!asset) {
+        return nil;
+    }
+    return [[InstancePool alloc] init:self :bindings::wrap<FilamentAsset>(asset) :(void* const*) cppInstances :capacity];
 }
 
 - (void)destroyAsset:(FilamentAsset *)asset{
+    bindings::forgetWrappersOwnedBy(asset.asset);
     nativeLoader->destroyAsset((filament::gltfio::FilamentAsset*) asset.asset);
 }
 
@@ -77,13 +104,14 @@
     auto materialsCount = nativeLoader->getMaterialsCount();
     auto res = [[NSMutableArray alloc] init];
     for (auto i = 0; i<materialsCount; i++) {
-        auto mat = [[Material alloc] init:(void*)materials[i]];
+        auto mat = bindings::wrap<Material>(materials[i], nativeLoader);
         [res addObject: mat];
     }
     return res;
 }
 
 + (void)destroy:(nonnull AssetLoader *)loader {
+    bindings::forgetWrappersOwnedBy(loader->nativeLoader);
     filament::gltfio::AssetLoader::destroy(&loader->nativeLoader);
 }
 
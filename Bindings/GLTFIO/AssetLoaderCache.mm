@@ -0,0 +1,187 @@
+//
+//  AssetLoaderCache.mm
+//
+#import "Bindings/GLTFIO/AssetLoaderCache.h"
+#import "Bindings/GLTFIO/AssetLoader.h"
+#import <CommonCrypto/CommonDigest.h>
+#import <gltfio/FilamentAsset.h>
+#import <gltfio/FilamentInstance.h>
+
+#include <tsl/robin_map.h>
+#include <tsl/robin_set.h>
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <vector>
+
+namespace {
+
+/**
+ * Identifies the content of a source by its SHA-256 digest and length, so that neither a copy
+ * of the source nor a comparison of its bytes is needed to tell contents apart.
+ */
+struct Key {
+    uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+    size_t length;
+
+    bool operator==(Key const& other) const noexcept {
+        return length == other.length && std::memcmp(digest, other.digest, sizeof(digest)) == 0;
+    }
+};
+
+struct KeyHash {
+    size_t operator()(Key const& key) const noexcept {
+        size_t hash;
+        std::memcpy(&hash, key.digest, sizeof(hash));
+        return hash;
+    }
+};
+
+Key keyOf(NSData* bytes) {
+    Key key;
+    key.length = bytes.length;
+    CC_SHA256_CTX context;
+    CC_SHA256_Init(&context);
+    // CC_LONG is 32 bits, so large sources are digested in chunks
+    auto data = (const uint8_t*) bytes.bytes;
+    for (size_t remaining = bytes.length; remaining > 0;) {
+        CC_LONG const chunk = (CC_LONG) std::min<size_t>(remaining, UINT32_MAX);
+        CC_SHA256_Update(&context, data, chunk);
+        data += chunk;
+        remaining -= chunk;
+    }
+    CC_SHA256_Final(key.digest, &context);
+    return key;
+}
+
+struct Entry {
+    Key key;
+    FilamentAsset* asset;
+    // instances of the asset that are not in use
+    std::vector<FilamentInstance*> available;
+    // native instances handed out by acquire and not recycled yet, the references to the asset
+    tsl::robin_set<const void*> inUse;
+};
+
+using Entries = std::list<Entry>;
+
+}
+
+@implementation AssetLoaderCache{
+    AssetLoader* loader;
+    AssetCreated created;
+    // from the most to the least recently used
+    Entries entries;
+    tsl::robin_map<Key, Entries::iterator, KeyHash> byKey;
+    tsl::robin_map<const void*, Entries::iterator> byAsset;
+    size_t byteCount;
+    uint64_t hits;
+    uint64_t misses;
+}
+
+- (instancetype)init:(AssetLoader *)loader :(size_t)byteBudget :(AssetCreated)created{
+    self = [super init];
+    self->loader = loader;
+    self->created = created;
+    self->_byteBudget = byteBudget;
+    return self;
+}
+
+- (void)setByteBudget:(size_t)byteBudget{
+    _byteBudget = byteBudget;
+    [self evict:byteBudget];
+}
+
+- (FilamentInstance *)acquire:(NSData *)bytes{
+    Key const key = keyOf(bytes);
+    auto found = byKey.find(key);
+    if (found != byKey.end()) {
+        auto entry = found->second;
+        entries.splice(entries.begin(), entries, entry);
+        FilamentInstance* instance;
+        if (!entry->available.empty()) {
+            instance = entry->available.back();
+            entry->available.pop_back();
+        } else {
+            instance = [loader createInstance:entry->asset];
+        }
+        if (instance) {
+            entry->inUse.insert(instance.instance);
+            hits++;
+        }
+        return instance;
+    }
+
+    // gltfio keeps its own copy of what it needs from the source
+    NSMutableArray<FilamentInstance*>* instances = [NSMutableArray arrayWithCapacity:1];
+    FilamentAsset* asset = [loader createInstancedAsset:bytes :1 :instances];
+    if (!asset) {
+        return nil;
+    }
+    misses++;
+    if (created) {
+        created(asset);
+    }
+    FilamentInstance* instance = instances.firstObject;
+    entries.push_front({ key, asset, {}, { instance.instance } });
+    byKey.insert({ key, entries.begin() });
+    byAsset.insert({ asset.asset, entries.begin() });
+    byteCount += key.length;
+    [self evict:_byteBudget];
+    return instance;
+}
+
+- (void)recycle:(FilamentInstance *)instance{
+    auto asset = ((filament::gltfio::FilamentInstance*) instance.instance)->getAsset();
+    auto found = byAsset.find(asset);
+    if (found == byAsset.end()) {
+        return;
+    }
+    auto entry = found->second;
+    // instances made outside the cache, or already recycled, are not references
+    if (entry->inUse.erase(instance.instance) == 0) {
+        return;
+    }
+    entry->available.push_back(instance);
+    if (entry->inUse.empty()) {
+        [self evict:_byteBudget];
+    }
+}
+
+- (void)trim{
+    [self evict:0];
+}
+
+- (void)evict:(size_t)budget{
+    auto entry = entries.end();
+    while (byteCount > budget && entry != entries.begin()) {
+        --entry;
+        if (!entry->inUse.empty()) {
+            continue;
+        }
+        byKey.erase(entry->key);
+        byAsset.erase(entry->asset.asset);
+        byteCount -= entry->key.length;
+        [loader destroyAsset:entry->asset];
+        entry = entries.erase(entry);
+    }
+}
+
+- (size_t)getAssetCount{
+    return entries.size();
+}
+
+- (size_t)getByteCount{
+    return byteCount;
+}
+
+- (uint64_t)getHitCount{
+    return hits;
+}
+
+- (uint64_t)getMissCount{
+    return misses;
+}
+
+@end
@@ -0,0 +1,640 @@
+//
+//  DecoderPool.mm
+//
+#import "Bindings/GLTFIO/DecoderPool.h"
+#import <filament/Engine.h>
+#import <filament/Texture.h>
+#import <gltfio/ResourceLoader.h>
+#import <gltfio/TextureProvider.h>
+#import "../Buffers.h"
+
+#include <tsl/robin_map.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+// libstb is linked with the package but its header is not part of the frameworks.
+extern "C" {
+unsigned char* stbi_load_from_memory(const unsigned char* buffer, int length, int* x, int* y,
+        int* channels, int desiredChannels);
+int stbi_info_from_memory(const unsigned char* buffer, int length, int* x, int* y, int* channels);
+void stbi_image_free(void* pixels);
+}
+
+namespace {
+
+using filament::Engine;
+using filament::Texture;
+using Clock = std::chrono::steady_clock;
+
+class PooledProvider;
+
+/**
+ * A cache of decoded textures: the RGBA pixels of images keyed by the contents of their source,
+ * which can be written to a file and mapped back instead of decoding the same images again on
+ * the next launch. Nothing else about assets is stored.
+ *
+ * The file holds a header, a table of records in no particular order, then the RGBA pixels of
+ * each image aligned to 16 bytes. All values are in the host's byte order.
+ */
+class Snapshot {
+public:
+    struct Key {
+        uint64_t hash;
+        uint64_t length;
+    };
+
+    struct Image {
+        uint32_t width;
+        uint32_t height;
+        size_t offset;
+    };
+
+    /**
+     * Hashes a source on the main thread, before it is queued, so it is read 32 bytes at a time
+     * in four independent lanes: this is xxHash64 with a seed of 0. The hash must not change
+     * between launches.
+     */
+    static Key keyOf(const uint8_t* data, size_t length) {
+        const uint8_t* p = data;
+        const uint8_t* const end = data + length;
+        uint64_t hash;
+        if (length >= 32) {
+            uint64_t lanes[4] = { PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1 };
+            for (; end - p >= 32; p += 32) {
+                for (size_t i = 0; i < 4; i++) {
+                    lanes[i] = round(lanes[i], load64(p + i * 8));
+                }
+            }
+            hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+            for (size_t i = 0; i < 4; i++) {
+                hash = (hash ^ round(0, lanes[i])) * PRIME1 + PRIME4;
+            }
+        } else {
+            hash = PRIME5;
+        }
+        hash += length;
+        for (; end - p >= 8; p += 8) {
+            hash = rotl(hash ^ round(0, load64(p)), 27) * PRIME1 + PRIME4;
+        }
+        for (; p < end; p++) {
+            hash = rotl(hash ^ (*p * PRIME5), 11) * PRIME1;
+        }
+        hash = (hash ^ (hash >> 33)) * PRIME2;
+        hash = (hash ^ (hash >> 29)) * PRIME3;
+        return { hash ^ (hash >> 32), length };
+    }
+
+    bool load(NSData* data) {
+        auto const bytes = (const uint8_t*) data.bytes;
+        Header header;
+        if (data.length < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, bytes, sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION
+                || header.count > (data.length - sizeof(header)) / sizeof(Record)) {
+            return false;
+        }
+        tsl::robin_map<uint64_t, Entry> images;
+        images.reserve(header.count);
+        for (uint32_t i = 0; i < header.count; i++) {
+            Record record;
+            std::memcpy(&record, bytes + sizeof(header) + i * sizeof(record), sizeof(record));
+            uint64_t const size = uint64_t(record.width) * record.height * 4;
+            if (record.offset > data.length || size > data.length - record.offset) {
+                return false;
+            }
+            images[record.hash] = { record.length, { record.width, record.height, size_t(record.offset) } };
+        }
+        mData = data;
+        mImages = std::move(images);
+        return true;
+    }
+
+    // Only used on the main thread, like load().
+    NSData* find(Key key, Image* image) const {
+        auto found = mImages.find(key.hash);
+        if (found == mImages.end() || found->second.length != key.length) {
+            return nil;
+        }
+        *image = found->second.image;
+        return mData;
+    }
+
+    bool isActive() const {
+        return mRecording || !mImages.empty();
+    }
+
+    void setRecording(bool recording) {
+        mRecording = recording;
+    }
+
+    bool isRecording() const {
+        return mRecording;
+    }
+
+    void record(Key key, uint32_t width, uint32_t height, const uint8_t* pixels) {
+        std::lock_guard<std::mutex> guard(mLock);
+        auto& recorded = mRecorded[key.hash];
+        if (recorded.pixels.empty()) {
+            recorded = { key.length, width, height,
+                    std::vector<uint8_t>(pixels, pixels + size_t(width) * height * 4) };
+        }
+    }
+
+    NSData* write() {
+        std::lock_guard<std::mutex> guard(mLock);
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.count = uint32_t(mRecorded.size());
+        size_t offset = align(sizeof(header) + mRecorded.size() * sizeof(Record));
+        size_t size = offset;
+        for (auto const& [hash, recorded] : mRecorded) {
+            size = align(size + recorded.pixels.size());
+        }
+        NSMutableData* data = [NSMutableData dataWithLength:size];
+        auto const bytes = (uint8_t*) data.mutableBytes;
+        std::memcpy(bytes, &header, sizeof(header));
+        size_t i = 0;
+        for (auto const& [hash, recorded] : mRecorded) {
+            Record const record{ hash, recorded.length, recorded.width, recorded.height, offset };
+            std::memcpy(bytes + sizeof(header) + i++ * sizeof(record), &record, sizeof(record));
+            std::memcpy(bytes + offset, recorded.pixels.data(), recorded.pixels.size());
+            offset = align(offset + recorded.pixels.size());
+        }
+        return data;
+    }
+
+private:
+    static constexpr char MAGIC[8] = { 'F', 'I', 'L', 'A', 'S', 'N', 'A', 'P' };
+    // 2: sources are hashed by keyOf's word-wide hash instead of FNV-1a
+    static constexpr uint32_t VERSION = 2;
+
+    static constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t PRIME3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ull;
+
+    static uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t round(uint64_t acc, uint64_t input) {
+        return rotl(acc + input * PRIME2, 31) * PRIME1;
+    }
+
+    static uint64_t load64(const uint8_t* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t count;
+    };
+
+    struct Record {
+        uint64_t hash;
+        uint64_t length;
+        uint32_t width;
+        uint32_t height;
+        uint64_t offset;
+    };
+
+    struct Entry {
+        uint64_t length;
+        Image image;
+    };
+
+    struct Recorded {
+        uint64_t length;
+        uint32_t width;
+        uint32_t height;
+        std::vector<uint8_t> pixels;
+    };
+
+    static size_t align(size_t size) {
+        return (size + 15) & ~size_t(15);
+    }
+
+    NSData* mData;
+    tsl::robin_map<uint64_t, Entry> mImages;
+    std::atomic<bool> mRecording{ false };
+    std::mutex mLock;
+    tsl::robin_map<uint64_t, Recorded> mRecorded;
+};
+
+struct Job {
+    enum State : uint8_t {
+        QUEUED, DECODING, DECODED, FAILED, CANCELLED
+    };
+    PooledProvider* provider;
+    Texture* texture;
+    std::vector<uint8_t> source;
+    int priority;
+    bool color;
+    uint64_t order = 0;
+    std::atomic<State> state{ QUEUED };
+    // owned by the job until it is handed to the texture
+    unsigned char* pixels = nullptr;
+    // or the snapshot holding the decoded image
+    NSData* snapshot;
+    size_t offset;
+    uint32_t width;
+    uint32_t height;
+    Snapshot::Key key{};
+
+    ~Job() {
+        stbi_image_free(pixels);
+    }
+};
+
+// The worker threads and the snapshot shared by all the providers of a pool.
+class DecoderQueue {
+public:
+    explicit DecoderQueue(size_t threadCount) {
+        mThreads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; i++) {
+            mThreads.emplace_back(&DecoderQueue::run, this);
+        }
+    }
+
+    ~DecoderQueue() {
+        {
+            std::lock_guard<std::mutex> guard(mLock);
+            mStopping = true;
+        }
+        mCondition.notify_all();
+        for (auto& thread : mThreads) {
+            thread.join();
+        }
+    }
+
+    void push(std::shared_ptr<Job> job) {
+        {
+            std::lock_guard<std::mutex> guard(mLock);
+            job->order = mOrder++;
+            mJobs.push(std::move(job));
+        }
+        mCondition.notify_one();
+    }
+
+    size_t getQueuedCount() {
+        std::lock_guard<std::mutex> guard(mLock);
+        return mJobs.size();
+    }
+
+    // The budget and deadlines are only used on the main thread.
+    void setBudget(double seconds) {
+        mBudget = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    void beginUpdate() {
+        mUpdateDeadline = getDeadline();
+        mInUpdate = true;
+    }
+
+    void endUpdate() {
+        mInUpdate = false;
+    }
+
+    Clock::time_point getDeadline() const {
+        if (mInUpdate) {
+            return mUpdateDeadline;
+        }
+        return mBudget.count() > 0 ? Clock::now() + mBudget : Clock::time_point::max();
+    }
+
+    Snapshot& getSnapshot() {
+        return mSnapshot;
+    }
+
+private:
+    struct ByPriority {
+        bool operator()(std::shared_ptr<Job> const& a, std::shared_ptr<Job> const& b) const {
+            if (a->priority != b->priority) {
+                return a->priority < b->priority;
+            }
+            if (a->color != b->color) {
+                return b->color;
+            }
+            return a->order > b->order;
+        }
+    };
+
+    void run();
+
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    std::priority_queue<std::shared_ptr<Job>, std::vector<std::shared_ptr<Job>>, ByPriority> mJobs;
+    std::vector<std::thread> mThreads;
+    uint64_t mOrder = 0;
+    bool mStopping = false;
+
+    Clock::duration mBudget{};
+    Clock::time_point mUpdateDeadline;
+    bool mInUpdate = false;
+
+    Snapshot mSnapshot;
+};
+
+/**
+ * Decodes PNG and JPEG images with stb_image like gltfio's own provider, but on the threads of
+ * a DecoderQueue rather than the engine's job system, and uploads them within a time budget.
+ */
+class PooledProvider : public filament::gltfio::TextureProvider {
+public:
+    PooledProvider(Engine* engine, std::shared_ptr<DecoderQueue> queue, int priority)
+            : mEngine(engine), mQueue(std::move(queue)), mPriority(priority) {}
+
+    ~PooledProvider() override {
+        cancelDecoding();
+    }
+
+    Texture* pushTexture(const uint8_t* data, size_t byteCount, const char* mimeType,
+            TextureFlags flags) override {
+        int width, height, channels;
+        if (!stbi_info_from_memory(data, int(byteCount), &width, &height, &channels)) {
+            mPushMessage = std::string("Unable to parse texture: ") + mimeType;
+            return nullptr;
+        }
+        bool const color = any(flags & TextureFlags::sRGB);
+        Texture* texture = Texture::Builder()
+                .width(width)
+                .height(height)
+                .levels(0xff)
+                .format(color ? Texture::InternalFormat::SRGB8_A8 : Texture::InternalFormat::RGBA8)
+                .build(*mEngine);
+        if (!texture) {
+            mPushMessage = "Unable to build Texture object.";
+            return nullptr;
+        }
+        mPushMessage.clear();
+
+        auto job = std::make_shared<Job>();
+        job->provider = this;
+        job->texture = texture;
+        job->priority = mPriority;
+        job->color = color;
+        job->width = width;
+        job->height = height;
+        mPushedCount++;
+
+        auto& snapshot = mQueue->getSnapshot();
+        if (snapshot.isActive()) {
+            job->key = Snapshot::keyOf(data, byteCount);
+            Snapshot::Image image;
+            job->snapshot = snapshot.find(job->key, &image);
+            if (job->snapshot && image.width == job->width && image.height == job->height) {
+                job->offset = image.offset;
+                job->state = Job::DECODED;
+                if (snapshot.isRecording()) {
+                    snapshot.record(job->key, image.width, image.height,
+                            (const uint8_t*) job->snapshot.bytes + image.offset);
+                }
+                mJobs.push_back(std::move(job));
+                return texture;
+            }
+            job->snapshot = nil;
+        }
+
+        job->source.assign(data, data + byteCount);
+        mJobs.push_back(job);
+        {
+            std::lock_guard<std::mutex> guard(mLock);
+            mInFlight++;
+        }
+        mQueue->push(std::move(job));
+        return texture;
+    }
+
+    Texture* popTexture() override {
+        if (mReady.empty()) {
+            mPopMessage.clear();
+            return nullptr;
+        }
+        auto job = std::move(mReady.front());
+        mReady.pop_front();
+        switch (job->state.load()) {
+            case Job::FAILED:
+                mPopMessage = "Unable to decode texture.";
+                break;
+            case Job::CANCELLED:
+                mPopMessage = "Texture decoding was cancelled.";
+                break;
+            default:
+                mPopMessage.clear();
+                break;
+        }
+        mPoppedCount++;
+        return job->texture;
+    }
+
+    void updateQueue() override {
+        auto const deadline = mQueue->getDeadline();
+        bool uploaded = false;
+        size_t kept = 0;
+        for (size_t i = 0; i < mJobs.size(); i++) {
+            auto& job = mJobs[i];
+            auto const state = job->state.load();
+            bool ready = state == Job::FAILED || state == Job::CANCELLED;
+            // at least one image is uploaded per update so that loading always progresses
+            if (state == Job::DECODED && (!uploaded || Clock::now() < deadline)) {
+                upload(*job);
+                uploaded = true;
+                ready = true;
+            }
+            if (ready) {
+                mReady.push_back(std::move(job));
+                mDecodedCount++;
+            } else if (kept != i) {
+                mJobs[kept++] = std::move(job);
+            } else {
+                kept++;
+            }
+        }
+        mJobs.resize(kept);
+    }
+
+    const char* getPushMessage() const override {
+        return mPushMessage.empty() ? nullptr : mPushMessage.c_str();
+    }
+
+    const char* getPopMessage() const override {
+        return mPopMessage.empty() ? nullptr : mPopMessage.c_str();
+    }
+
+    void waitForCompletion() override {
+        std::unique_lock<std::mutex> lock(mLock);
+        mCondition.wait(lock, [this] { return mInFlight == 0; });
+    }
+
+    void cancelDecoding() override {
+        for (auto& job : mJobs) {
+            auto expected = Job::QUEUED;
+            if (job->state.compare_exchange_strong(expected, Job::CANCELLED)) {
+                std::lock_guard<std::mutex> guard(mLock);
+                mInFlight--;
+            }
+        }
+        waitForCompletion();
+    }
+
+    size_t getPushedCount() const override { return mPushedCount; }
+    size_t getPoppedCount() const override { return mPoppedCount; }
+    size_t getDecodedCount() const override { return mDecodedCount; }
+
+    // Called on a worker thread once a job is decoded. The provider may be destroyed as soon as
+    // the lock is released, so the condition is notified under the lock and the worker must not
+    // touch the provider after this returns.
+    void onDecoded() {
+        std::lock_guard<std::mutex> guard(mLock);
+        mInFlight--;
+        mCondition.notify_all();
+    }
+
+private:
+    void upload(Job& job) {
+        size_t const size = size_t(job.width) * job.height * 4;
+        if (job.snapshot) {
+            job.texture->setImage(*mEngine, 0, bindings::retainedPixelBuffer(job.snapshot,
+                    job.offset, size, Texture::Format::RGBA, Texture::Type::UBYTE, 1, 0, 0, 0));
+            job.snapshot = nil;
+        } else {
+            Texture::PixelBufferDescriptor buffer(job.pixels, size,
+                    Texture::Format::RGBA, Texture::Type::UBYTE,
+                    [](void* pixels, size_t, void*) { stbi_image_free(pixels); });
+            job.pixels = nullptr;
+            job.texture->setImage(*mEngine, 0, std::move(buffer));
+        }
+        job.texture->generateMipmaps(*mEngine);
+    }
+
+    Engine* const mEngine;
+    std::shared_ptr<DecoderQueue> const mQueue;
+    int const mPriority;
+
+    // the job lists and counters are only used on the main thread
+    std::vector<std::shared_ptr<Job>> mJobs;
+    std::deque<std::shared_ptr<Job>> mReady;
+    size_t mPushedCount = 0;
+    size_t mPoppedCount = 0;
+    size_t mDecodedCount = 0;
+    std::string mPushMessage;
+    std::string mPopMessage;
+
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    size_t mInFlight = 0;
+};
+
+void DecoderQueue::run() {
+    for (;;) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mCondition.wait(lock, [this] { return mStopping || !mJobs.empty(); });
+            if (mStopping) {
+                return;
+            }
+            job = mJobs.top();
+            mJobs.pop();
+        }
+        // cancelled jobs are left in the queue and skipped here
+        auto expected = Job::QUEUED;
+        if (!job->state.compare_exchange_strong(expected, Job::DECODING)) {
+            continue;
+        }
+        int width, height, channels;
+        job->pixels = stbi_load_from_memory(job->source.data(), int(job->source.size()),
+                &width, &height, &channels, 4);
+        job->source = {};
+        if (job->pixels && job->key.length > 0 && mSnapshot.isRecording()) {
+            mSnapshot.record(job->key, job->width, job->height, job->pixels);
+        }
+        job->state = job->pixels ? Job::DECODED : Job::FAILED;
+        // last use of the provider, which may be destroyed once it is notified
+        job->provider->onDecoded();
+    }
+}
+
+}
+
+@implementation DecoderPool{
+    std::shared_ptr<DecoderQueue> queue;
+}
+
+- (instancetype)init:(NSUInteger)threadCount{
+    self = [super init];
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+    self->_threadCount = threadCount;
+    self->queue = std::make_shared<DecoderQueue>(threadCount);
+    self.uploadBudget = 0.004;
+    return self;
+}
+
+- (void)setUploadBudget:(NSTimeInterval)uploadBudget{
+    _uploadBudget = uploadBudget;
+    queue->setBudget(uploadBudget);
+}
+
+- (TextureProvider *)createTextureProvider:(Engine *)engine{
+    return [self createTextureProvider:engine :0];
+}
+
+- (TextureProvider *)createTextureProvider:(Engine *)engine :(int)priority{
+    auto provider = new PooledProvider((filament::Engine*) engine.engine, queue, priority);
+    return [[TextureProvider alloc] init:provider];
+}
+
+- (double)update:(NSArray<ResourceLoader *> *)loaders{
+    double progress = 1;
+    queue->beginUpdate();
+    for (ResourceLoader* loader in loaders) {
+        auto nativeLoader = (filament::gltfio::ResourceLoader*) loader.loader;
+        nativeLoader->asyncUpdateLoad();
+        progress = std::min(progress, (double) nativeLoader->asyncGetLoadProgress());
+    }
+    queue->endUpdate();
+    return progress;
+}
+
+- (NSUInteger)getQueuedCount{
+    return queue->getQueuedCount();
+}
+
+- (void)setRecording:(bool)recording{
+    queue->getSnapshot().setRecording(recording);
+}
+
+- (bool)recording{
+    return queue->getSnapshot().isRecording();
+}
+
+- (bool)loadSnapshot:(NSString *)path{
+    NSData* data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:nil];
+    return data && queue->getSnapshot().load(data);
+}
+
+- (bool)writeSnapshot:(NSString *)path{
+    return [queue->getSnapshot().write() writeToFile:path atomically:true];
+}
+
+@end
@@ -10,6 +10,9 @@
 #import <gltfio/FilamentAsset.h>
 #import <utils/Entity.h>
 #import <filament/Scene.h>
+#import "../Bounds.h"
+#import "../Entities.h"
+#import "../Wrappers.h"
 
 @implementation FilamentAsset{
     filament::gltfio::FilamentAsset* nativeAsset;
@@ -51,6 +54,30 @@
     auto count = nativeAsset->getCameraEntityCount();
     return [FilamentAsset getEntitiesArray:ents :count];
 }
+- (const Entity *)getEntitiesData{
+    return bindings::fromNative(nativeAsset->getEntities());
+}
+- (size_t)getEntityCount{
+    return nativeAsset->getEntityCount();
+}
+- (const Entity *)getLightEntitiesData{
+    return bindings::fromNative(nativeAsset->getLightEntities());
+}
+- (size_t)getLightEntityCount{
+    return nativeAsset->getLightEntityCount();
+}
+- (const Entity *)getRenderableEntitiesData{
+    return bindings::fromNative(nativeAsset->getRenderableEntities());
+}
+- (size_t)getRenderableEntityCount{
+    return nativeAsset->getRenderableEntityCount();
+}
+- (const Entity *)getCameraEntitiesData{
+    return bindings::fromNative(nativeAsset->getCameraEntities());
+}
+- (size_t)getCameraEntityCount{
+    return nativeAsset->getCameraEntityCount();
+}
 - (Entity)getRoot{
     return utils::Entity::smuggle(nativeAsset->getRoot());
 }
@@ -61,17 +88,12 @@
     if(entities == nil){
         return nativeAsset->popRenderables(nil, 0);
     }
-    utils::Entity ents[entities.count];
-    for(auto i = 0; i<entities.count; i++){
-        ents[i] = utils::Entity::import(entities[i].unsignedIntValue);
-    }
-    
-    auto count = nativeAsset->popRenderables(ents, entities.count);
-    for (auto j = 0; j<count; j++) {
-        entities[j] = [NSNumber numberWithUnsignedInt:utils::Entity::smuggle(ents[j])];
-    }
-    return count;
-    
+    return bindings::fillEntityChunks(entities, [&](utils::Entity* ents, size_t count) {
+        return nativeAsset->popRenderables(ents, count);
+    });
+}
+- (size_t)popRenderables:(Entity *)entities :(size_t)count{
+    return nativeAsset->popRenderables(bindings::toNative(entities), count);
 }
 - (NSArray<NSString*>*)getResourceUris{
     auto uris = nativeAsset->getResourceUris();
@@ -98,16 +120,16 @@
     return utils::Entity::smuggle(entity);
 }
 - (NSArray<NSNumber *> *)getEntitiesByName:(NSString *)name{
-    auto count = nativeAsset->getEntitiesByName([name UTF8String], nil, 0);
-    utils::Entity ents[count];
-    nativeAsset->getEntitiesByName([name UTF8String], ents, count);
-    return [FilamentAsset getEntitiesArray:ents :count];
+    return [self getEntitiesByName:name :SIZE_MAX];
 }
 - (NSArray<NSNumber *> *)getEntitiesByPrefix:(NSString *)name{
-    auto count = nativeAsset->getEntitiesByPrefix([name UTF8String], nil, 0);
-    utils::Entity ents[count];
-    nativeAsset->getEntitiesByPrefix([name UTF8String], ents, count);
-    return [FilamentAsset getEntitiesArray:ents :count];
+    return [self getEntitiesByPrefix:name :SIZE_MAX];
+}
+- (size_t)getEntitiesByName:(NSString *)name :(Entity *)entities :(size_t)maxCount{
+    return nativeAsset->getEntitiesByName(name.UTF8String, bindings::toNative(entities), maxCount);
+}
+- (size_t)getEntitiesByPrefix:(NSString *)prefix :(Entity *)entities :(size_t)maxCount{
+    return nativeAsset->getEntitiesByPrefix(prefix.UTF8String, bindings::toNative(entities), maxCount);
 }
 - (NSString *)getExtras:(Entity)entity{
     auto name = nativeAsset->getExtras(utils::Entity::import(entity));
@@ -118,14 +140,17 @@
 }
 - (void)addEntitiesToScene:(nonnull Scene *)targetScene :(nonnull NSArray<NSNumber*>*)entities :(uint32_t)sceneFilter {
     auto scene = (filament::Scene*) targetScene.scene;
-    utils::Entity ents[entities.count];
-    for (auto i = 0; i<entities.count; i++) {
-        ents[i] = utils::Entity::import([entities[i] unsignedIntValue]);
-    }
-    
     auto filter = filament::gltfio::NodeManager::SceneMask();
     filter.setValue(sceneFilter);
-    nativeAsset->addEntitiesToScene(*scene, ents, entities.count, filter);
+    bindings::forEachEntityChunk(entities, [&](const utils::Entity* ents, size_t count) {
+        nativeAsset->addEntitiesToScene(*scene, ents, count, filter);
+    });
+}
+
+- (void)addEntitiesToScene:(nonnull Scene *)targetScene :(nonnull const Entity *)entities :(size_t)count :(uint32_t)sceneFilter {
+    auto filter = filament::gltfio::NodeManager::SceneMask();
+    filter.setValue(sceneFilter);
+    nativeAsset->addEntitiesToScene(*(filament::Scene*) targetScene.scene, bindings::toNative(entities), count, filter);
 }
 
 - (bool)areFilamentComponentsDetached {
@@ -142,31 +167,25 @@
 }
 
 - (nonnull NSArray<NSNumber *> *)getEntitiesByName:(nonnull NSString *)name :(size_t)maxCount {
-    utils::Entity ents[maxCount];
-    auto size = nativeAsset->getEntitiesByName(name.UTF8String, ents, maxCount);
-    auto res = [[NSMutableArray alloc] init];
-    for(auto i = 0; i<size; i++){
-        auto ent = utils::Entity::smuggle(ents[i]);
-        auto number = [[NSNumber alloc] initWithUnsignedInt:ent];
-        [res addObject: number];
-    }
-    return res;
+    auto str = name.UTF8String;
+    auto count = std::min(maxCount, nativeAsset->getEntitiesByName(str, nil, 0));
+    bindings::ScratchScope scratch;
+    auto ents = scratch.allocate<utils::Entity>(count);
+    auto size = nativeAsset->getEntitiesByName(str, ents, count);
+    return [FilamentAsset getEntitiesArray:ents :size];
 }
 
 - (nonnull NSArray<NSNumber *> *)getEntitiesByPrefix:(nonnull NSString *)prefix :(size_t)maxCount {
-    utils::Entity ents[maxCount];
-    auto size = nativeAsset->getEntitiesByPrefix(prefix.UTF8String, ents, maxCount);
-    auto res = [[NSMutableArray alloc] init];
-    for(auto i = 0; i<size; i++){
-        auto ent = utils::Entity::smuggle(ents[i]);
-        auto number = [[NSNumber alloc] initWithUnsignedInt:ent];
-        [res addObject: number];
-    }
-    return res;
+    auto str = prefix.UTF8String;
+    auto count = std::min(maxCount, nativeAsset->getEntitiesByPrefix(str, nil, 0));
+    bindings::ScratchScope scratch;
+    auto ents = scratch.allocate<utils::Entity>(count);
+    auto size = nativeAsset->getEntitiesByPrefix(str, ents, count);
+    return [FilamentAsset getEntitiesArray:ents :size];
 }
 
 - (nonnull FilamentInstance *)getInstance {
-    return [[FilamentInstance alloc] init: nativeAsset->getInstance()];
+    return bindings::wrap<FilamentInstance>(nativeAsset->getInstance(), nativeAsset);
 }
 
 - (size_t)getMorphTargetCountAt:(Entity)entity {
@@ -201,4 +220,13 @@
     nativeAsset->releaseSourceData();
 }
 
+- (size_t)getWorldBoundingBoxes:(Entity *)renderables :(Box *)boxes :(size_t)capacity{
+    return bindings::worldBoundingBoxes(*nativeAsset->getEngine(), nativeAsset->getEntities(), nativeAsset->getEntityCount(),
+            renderables ? bindings::toNative(renderables) : nullptr, boxes, capacity);
+}
+
+- (Box)getWorldBoundingBox{
+    return bindings::worldBoundingBox(*nativeAsset->getEngine(), nativeAsset->getEntities(), nativeAsset->getEntityCount());
+}
+
 @end
@@ -4,9 +4,13 @@
 //  Created by Stef Tervelde on 30.06.22.
 //
 #import "Bindings/GLTFIO/FilamentInstance.h"
+#import <gltfio/FilamentAsset.h>
 #import <gltfio/FilamentInstance.h>
 #import "Bindings/GLTFIO/FilamentAsset.h"
 #import "Bindings/GLTFIO/Animator.h"
+#import "../Bounds.h"
+#import "../Entities.h"
+#import "../Wrappers.h"
 
 @implementation FilamentInstance{
     filament::gltfio::FilamentInstance* nativeInstance;
@@ -19,7 +23,7 @@
 }
 
 - (FilamentAsset *)getAsset{
-    return [[FilamentAsset alloc] init: (void*)nativeInstance->getAsset()];
+    return bindings::wrap<FilamentAsset>(nativeInstance->getAsset());
 }
 - (Entity)getRoot{
     auto entity = nativeInstance->getRoot();
@@ -32,6 +36,12 @@
     return [FilamentAsset getEntitiesArray:ents :count];
     
 }
+- (const Entity *)getEntitiesData{
+    return bindings::fromNative(nativeInstance->getEntities());
+}
+- (size_t)getEntityCount{
+    return nativeInstance->getEntityCount();
+}
 + (NSArray<NSNumber*>*)getEntitiesArray: (const void*) array :(unsigned long)count{
     auto typedArray = (utils::Entity*) array;
     auto target = [[NSMutableArray alloc] initWithCapacity:count];
@@ -43,7 +53,7 @@
     return target;
 }
 - (Animator *)getAnimator{
-    return [[Animator alloc] init:nativeInstance->getAnimator()];
+    return bindings::wrap<Animator>(nativeInstance->getAnimator(), nativeInstance->getAsset());
 }
 - (void)applyMaterialVariant:(size_t)index{
     nativeInstance->applyMaterialVariant(index);
@@ -84,12 +94,20 @@
     return [FilamentAsset getEntitiesArray: joints :size];
 }
 
+- (nonnull const Entity *)getJointsDataAt:(size_t)skinIndex {
+    return bindings::fromNative(nativeInstance->getJointsAt(skinIndex));
+}
+
+- (size_t)getJointCountAt:(size_t)skinIndex {
+    return nativeInstance->getJointCountAt(skinIndex);
+}
+
 - (nonnull NSArray<MaterialInstance *> *)getMaterialInstances {
     auto instances = nativeInstance->getMaterialInstances();
     auto count = nativeInstance->getMaterialInstanceCount();
     auto res = [[NSMutableArray alloc] init];
     for (auto i = 0; i<count; i++) {
-        [res addObject:[[MaterialInstance alloc] init:instances[i]]];
+        [res addObject:bindings::wrap<MaterialInstance>(instances[i], nativeInstance->getAsset())];
     }
     return res;
 }
@@ -114,4 +132,13 @@
     nativeInstance->recomputeBoundingBoxes();
 }
 
+- (size_t)getWorldBoundingBoxes:(Entity *)renderables :(Box *)boxes :(size_t)capacity{
+    return bindings::worldBoundingBoxes(*nativeInstance->getAsset()->getEngine(), nativeInstance->getEntities(), nativeInstance->getEntityCount(),
+            renderables ? bindings::toNative(renderables) : nullptr, boxes, capacity);
+}
+
+- (Box)getWorldBoundingBox{
+    return bindings::worldBoundingBox(*nativeInstance->getAsset()->getEngine(), nativeInstance->getEntities(), nativeInstance->getEntityCount());
+}
+
 @end
@@ -0,0 +1,73 @@
+//
+//  InstancePool.mm
+//
+#import "Bindings/GLTFIO/InstancePool.h"
+#import "Bindings/GLTFIO/AssetLoader.h"
+#import <gltfio/FilamentAsset.h>
+#import <gltfio/FilamentInstance.h>
+#import "../Wrappers.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+@implementation InstancePool{
+    AssetLoader* loader;
+    std::mutex lock;
+    std::vector<filament::gltfio::FilamentInstance*> available;
+    size_t instanceCount;
+}
+
+- (instancetype)init:(AssetLoader *)loader :(FilamentAsset *)asset :(void *const *)instances :(size_t)count{
+    self = [super init];
+    self->loader = loader;
+    self->_asset = asset;
+    auto first = (filament::gltfio::FilamentInstance* const*) instances;
+    // handed out from the back, so reverse them to acquire in creation order
+    available.assign(std::make_reverse_iterator(first + count), std::make_reverse_iterator(first));
+    instanceCount = count;
+    return self;
+}
+
+- (FilamentInstance *)acquire{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!available.empty()) {
+            auto instance = available.back();
+            available.pop_back();
+            return bindings::wrap<FilamentInstance>(instance, _asset.asset);
+        }
+    }
+    FilamentInstance* instance = [loader createInstance:_asset];
+    if (instance) {
+        std::lock_guard<std::mutex> guard(lock);
+        instanceCount++;
+    }
+    return instance;
+}
+
+- (bool)recycle:(FilamentInstance *)instance{
+    auto const native = (filament::gltfio::FilamentInstance*) instance.instance;
+    if (native->getAsset() != _asset.asset) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    if (std::find(available.begin(), available.end(), native) != available.end()) {
+        return false;
+    }
+    available.push_back(native);
+    return true;
+}
+
+- (size_t)getAvailableCount{
+    std::lock_guard<std::mutex> guard(lock);
+    return available.size();
+}
+
+- (size_t)getInstanceCount{
+    std::lock_guard<std::mutex> guard(lock);
+    return instanceCount;
+}
+
+@end
@@ -0,0 +1,193 @@
+//
+//  SkinningBatch.mm
+//
+#import "Bindings/GLTFIO/SkinningBatch.h"
+#import "Bindings/Filament/Engine.h"
+#import "Bindings/Filament/SkinningBuffer.h"
+#import <filament/Engine.h>
+#import <filament/RenderableManager.h>
+#import <filament/SkinningBuffer.h>
+#import <filament/TransformManager.h>
+#import <gltfio/FilamentInstance.h>
+#import "../Kernels.h"
+#import "../Math.h"
+#import "../Scratch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+// Skins are computed in parallel once they have this many bones in total.
+constexpr size_t PARALLEL_MIN_BONES = 1024;
+
+struct Skin {
+    filament::gltfio::FilamentInstance* instance;
+    utils::Entity target;
+    const utils::Entity* joints;
+    const filament::math::mat4f* inverseBindMatrices;
+    uint32_t boneCount;
+    // null when the bones are set on the target
+    filament::SkinningBuffer* buffer;
+    uint32_t offset;
+    // index of the first bone of the skin in the palette
+    size_t first;
+};
+
+/** A range of the palette set on a renderable or uploaded to a buffer in one call. */
+struct Upload {
+    filament::SkinningBuffer* buffer;
+    utils::Entity target;
+    uint32_t offset;
+    uint32_t count;
+    size_t first;
+};
+
+simd_float4x4 toSimd(filament::math::mat4f const& m) {
+    simd_float4x4 result;
+    std::memcpy(&result, &m, sizeof(result));
+    return result;
+}
+
+}
+
+@implementation SkinningBatch{
+    std::vector<Skin> skins;
+    std::vector<Upload> uploads;
+    std::vector<simd_float4x4> palette;
+    size_t boneCount;
+    size_t uploadCount;
+    bool dirty;
+}
+
+- (instancetype)init{
+    self = [super init];
+    boneCount = 0;
+    uploadCount = 0;
+    dirty = false;
+    return self;
+}
+
+- (size_t)addSkin:(FilamentInstance *)instance :(size_t)skinIndex :(Entity)target{
+    return [self appendSkin:(filament::gltfio::FilamentInstance*) instance.instance :skinIndex :target :nullptr :0];
+}
+
+- (size_t)addSkin:(FilamentInstance *)instance :(size_t)skinIndex :(Entity)target :(SkinningBuffer *)buffer :(size_t)offset{
+    return [self appendSkin:(filament::gltfio::FilamentInstance*) instance.instance :skinIndex :target :(filament::SkinningBuffer*) buffer.buffer :offset];
+}
+
+- (size_t)appendSkin:(filament::gltfio::FilamentInstance*)instance :(size_t)skinIndex :(Entity)target :(filament::SkinningBuffer*)buffer :(size_t)offset{
+    auto const count = uint32_t(instance->getJointCountAt(skinIndex));
+    skins.push_back({ instance, utils::Entity::import(target), instance->getJointsAt(skinIndex),
+            instance->getInverseBindMatricesAt(skinIndex), count, buffer, uint32_t(offset), 0 });
+    boneCount += count;
+    dirty = true;
+    return count;
+}
+
+- (void)removeInstance:(FilamentInstance *)instance{
+    auto const native = (filament::gltfio::FilamentInstance*) instance.instance;
+    skins.erase(std::remove_if(skins.begin(), skins.end(), [native](Skin const& skin) {
+        return skin.instance == native;
+    }), skins.end());
+    boneCount = 0;
+    for (auto const& skin : skins) {
+        boneCount += skin.boneCount;
+    }
+    dirty = true;
+}
+
+- (void)clear{
+    skins.clear();
+    uploads.clear();
+    boneCount = 0;
+    dirty = false;
+}
+
+/**
+ * Orders the palette by buffer and offset, so that skins adjacent in a buffer are adjacent in
+ * the palette and uploaded together.
+ */
+- (void)layout{
+    bindings::ScratchScope scratch;
+    size_t const count = skins.size();
+    auto order = scratch.allocate<size_t>(count);
+    std::iota(order, order + count, size_t(0));
+    std::stable_sort(order, order + count, [&](size_t a, size_t b) {
+        auto const& sa = skins[a];
+        auto const& sb = skins[b];
+        return std::less<filament::SkinningBuffer*>()(sa.buffer, sb.buffer) || (sa.buffer == sb.buffer && sa.offset < sb.offset);
+    });
+    uploads.clear();
+    size_t first = 0;
+    for (size_t k = 0; k < count; k++) {
+        auto& skin = skins[order[k]];
+        skin.first = first;
+        first += skin.boneCount;
+        if (skin.buffer && !uploads.empty() && uploads.back().buffer == skin.buffer
+                && uploads.back().offset + uploads.back().count == skin.offset) {
+            uploads.back().count += skin.boneCount;
+            continue;
+        }
+        uploads.push_back({ skin.buffer, skin.target, skin.offset, skin.boneCount, skin.first });
+    }
+    palette.resize(first);
+    dirty = false;
+}
+
+- (void)update:(Engine *)engine{
+    if (dirty) {
+        [self layout];
+    }
+    auto& nativeEngine = *(filament::Engine*) engine.engine;
+    auto& tm = nativeEngine.getTransformManager();
+    auto& rm = nativeEngine.getRenderableManager();
+    Skin const* const skinData = skins.data();
+    simd_float4x4* const bones = palette.data();
+    filament::TransformManager const* const transforms = &tm;
+    // same as Animator::updateBoneMatrices, relative to the world transform of the target
+    void (^computeSkin)(size_t) = ^(size_t i) {
+        Skin const& skin = skinData[i];
+        auto const ti = transforms->getInstance(skin.target);
+        simd_float4x4 const inverseTarget = ti
+                ? bindings::affineInverse(toSimd(transforms->getWorldTransform(ti)))
+                : matrix_identity_float4x4;
+        for (size_t b = 0; b < skin.boneCount; b++) {
+            auto const ji = transforms->getInstance(skin.joints[b]);
+            simd_float4x4 const joint = ji ? simd_mul(inverseTarget, toSimd(transforms->getWorldTransform(ji))) : inverseTarget;
+            bones[skin.first + b] = simd_mul(joint, toSimd(skin.inverseBindMatrices[b]));
+        }
+    };
+    if (skins.size() > 1 && boneCount >= PARALLEL_MIN_BONES) {
+        dispatch_apply(skins.size(), DISPATCH_APPLY_AUTO, computeSkin);
+    } else {
+        for (size_t i = 0; i < skins.size(); i++) {
+            computeSkin(i);
+        }
+    }
+    auto const matrices = MAT4F_ARRAY_FROM_SIMD(bones);
+    for (auto const& upload : uploads) {
+        if (upload.buffer) {
+            upload.buffer->setBones(nativeEngine, matrices + upload.first, upload.count, upload.offset);
+        } else if (auto const ri = rm.getInstance(upload.target)) {
+            rm.setBones(ri, matrices + upload.first, upload.count);
+        }
+    }
+    uploadCount = uploads.size();
+}
+
+- (size_t)getSkinCount{
+    return skins.size();
+}
+
+- (size_t)getBoneCount{
+    return boneCount;
+}
+
+- (size_t)getUploadCount{
+    return uploadCount;
+}
+
+@end
@@ -0,0 +1,584 @@
+//
+//  Kernels.h
+//
+//  Bulk math over arrays, written with the simd vector types so that the compiler emits NEON
+//  on Apple silicon and SSE/AVX on Intel.
+//
+
+#ifndef Kernels_h
+#define Kernels_h
+
+#import <dispatch/dispatch.h>
+#import <simd/simd.h>
+#import "Bindings/Filament/Box.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace bindings {
+
+// Arrays are split in ranges of this many elements to be processed in parallel...
+constexpr size_t PARALLEL_CHUNK_COUNT = 8192;
+// ...once they hold at least this many elements.
+constexpr size_t PARALLEL_MIN_COUNT = 4 * PARALLEL_CHUNK_COUNT;
+
+/**
+ * Calls `fn(first, last)` on consecutive ranges covering [0, count), on the calling thread for
+ * short arrays and spread over the CPU cores otherwise. Ranges start at multiples of 8.
+ */
+template<typename Fn>
+void parallelFor(size_t count, Fn&& fn) {
+    if (count < PARALLEL_MIN_COUNT) {
+        fn(size_t(0), count);
+        return;
+    }
+    auto const f = &fn;
+    dispatch_apply((count + PARALLEL_CHUNK_COUNT - 1) / PARALLEL_CHUNK_COUNT, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        (*f)(i * PARALLEL_CHUNK_COUNT, std::min(count, (i + 1) * PARALLEL_CHUNK_COUNT));
+    });
+}
+
+inline simd_float8 load8(const float* p) {
+    return *(const simd_packed_float8*) p;
+}
+
+inline void store8(float* p, simd_float8 v) {
+    *(simd_packed_float8*) p = v;
+}
+
+inline Box loadBox(BoxArrays const& boxes, size_t i) {
+    return {
+        simd_make_float3(boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i]),
+        simd_make_float3(boxes.halfExtentX[i], boxes.halfExtentY[i], boxes.halfExtentZ[i])
+    };
+}
+
+inline void storeBox(BoxArrays const& boxes, size_t i, Box const& box) {
+    boxes.centerX[i] = box.center.x;
+    boxes.centerY[i] = box.center.y;
+    boxes.centerZ[i] = box.center.z;
+    boxes.halfExtentX[i] = box.halfExtent.x;
+    boxes.halfExtentY[i] = box.halfExtent.y;
+    boxes.halfExtentZ[i] = box.halfExtent.z;
+}
+
+/** The bounding box of `box` transformed by the affine transform `m`. */
+inline Box transformBox(simd_float4x4 const& m, Box const& box) {
+    simd_float4 const center = m.columns[0] * box.center.x + m.columns[1] * box.center.y
+            + m.columns[2] * box.center.z + m.columns[3];
+    simd_float4 const extent = simd_abs(m.columns[0]) * box.halfExtent.x
+            + simd_abs(m.columns[1]) * box.halfExtent.y + simd_abs(m.columns[2]) * box.halfExtent.z;
+    return { center.xyz, extent.xyz };
+}
+
+/** Transforms each box by its own matrix. `result` may be `boxes`. */
+inline void transformBoxes(const simd_float4x4* matrices, const Box* boxes, size_t count, Box* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = transformBox(matrices[i], boxes[i]);
+        }
+    });
+}
+
+/** Transforms each box stored in separate arrays by its own matrix. `result` may be `boxes`. */
+inline void transformBoxes(const simd_float4x4* matrices, BoxArrays boxes, size_t count, BoxArrays result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            storeBox(result, i, transformBox(matrices[i], loadBox(boxes, i)));
+        }
+    });
+}
+
+/**
+ * Transforms all the boxes stored in separate arrays by the same matrix, eight at a time.
+ * `result` may be `boxes`.
+ */
+inline void transformBoxes(simd_float4x4 const& m, BoxArrays boxes, size_t count, BoxArrays result) {
+    auto const& c = m.columns;
+    parallelFor(count, [=](size_t first, size_t last) {
+        size_t i = first;
+        for (; i + 8 <= last; i += 8) {
+            simd_float8 const cx = load8(boxes.centerX + i);
+            simd_float8 const cy = load8(boxes.centerY + i);
+            simd_float8 const cz = load8(boxes.centerZ + i);
+            simd_float8 const ex = load8(boxes.halfExtentX + i);
+            simd_float8 const ey = load8(boxes.halfExtentY + i);
+            simd_float8 const ez = load8(boxes.halfExtentZ + i);
+            store8(result.centerX + i, c[0].x * cx + c[1].x * cy + c[2].x * cz + c[3].x);
+            store8(result.centerY + i, c[0].y * cx + c[1].y * cy + c[2].y * cz + c[3].y);
+            store8(result.centerZ + i, c[0].z * cx + c[1].z * cy + c[2].z * cz + c[3].z);
+            store8(result.halfExtentX + i, std::abs(c[0].x) * ex + std::abs(c[1].x) * ey + std::abs(c[2].x) * ez);
+            store8(result.halfExtentY + i, std::abs(c[0].y) * ex + std::abs(c[1].y) * ey + std::abs(c[2].y) * ez);
+            store8(result.halfExtentZ + i, std::abs(c[0].z) * ex + std::abs(c[1].z) * ey + std::abs(c[2].z) * ez);
+        }
+        for (; i < last; i++) {
+            storeBox(result, i, transformBox(m, loadBox(boxes, i)));
+        }
+    });
+}
+
+/** The bounding box of all `boxes`, or an empty box at the origin if there are none. */
+inline Box unionOf(const Box* boxes, size_t count) {
+    if (count == 0) {
+        return { simd_make_float3(0, 0, 0), simd_make_float3(0, 0, 0) };
+    }
+    simd_float3 lo = boxes[0].center - boxes[0].halfExtent;
+    simd_float3 hi = boxes[0].center + boxes[0].halfExtent;
+    for (size_t i = 1; i < count; i++) {
+        lo = simd_min(lo, boxes[i].center - boxes[i].halfExtent);
+        hi = simd_max(hi, boxes[i].center + boxes[i].halfExtent);
+    }
+    return { (hi + lo) * 0.5f, (hi - lo) * 0.5f };
+}
+
+/** Multiplies each matrix of `a` by the matrix of `b` at the same index. */
+inline void multiply(const simd_float4x4* a, const simd_float4x4* b, size_t count, simd_float4x4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = simd_mul(a[i], b[i]);
+        }
+    });
+}
+
+/** Multiplies `a` by each matrix of `b`, e.g. a parent transform by local transforms. */
+inline void multiply(simd_float4x4 const& a, const simd_float4x4* b, size_t count, simd_float4x4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = simd_mul(a, b[i]);
+        }
+    });
+}
+
+/** Transforms each vector by the matrix at the same index. */
+inline void transform(const simd_float4x4* m, const simd_float4* v, size_t count, simd_float4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = simd_mul(m[i], v[i]);
+        }
+    });
+}
+
+/** Transforms each vector by the same matrix. */
+inline void transform(simd_float4x4 const& m, const simd_float4* v, size_t count, simd_float4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = simd_mul(m, v[i]);
+        }
+    });
+}
+
+/**
+ * The inverse of the upper 3x3 of `m`, transposed, i.e. its cofactors divided by its
+ * determinant. Columns are the cross products of the other two columns.
+ */
+inline simd_float3x3 inverseTranspose(simd_float4x4 const& m) {
+    simd_float3 const a = m.columns[0].xyz;
+    simd_float3 const b = m.columns[1].xyz;
+    simd_float3 const c = m.columns[2].xyz;
+    simd_float3 const bc = simd_cross(b, c);
+    float const inverseDeterminant = 1.0f / simd_dot(a, bc);
+    return simd_matrix(bc * inverseDeterminant,
+            simd_cross(c, a) * inverseDeterminant,
+            simd_cross(a, b) * inverseDeterminant);
+}
+
+/** The inverse of an affine transform, which is much cheaper than a general inverse. */
+inline simd_float4x4 affineInverse(simd_float4x4 const& m) {
+    simd_float3x3 const inverse = simd_transpose(inverseTranspose(m));
+    simd_float3 const t = -simd_mul(inverse, m.columns[3].xyz);
+    return simd_matrix(simd_make_float4(inverse.columns[0], 0), simd_make_float4(inverse.columns[1], 0),
+            simd_make_float4(inverse.columns[2], 0), simd_make_float4(t, 1));
+}
+
+/** Inverts each affine transform. `result` may be `m`. */
+inline void affineInverse(const simd_float4x4* m, size_t count, simd_float4x4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = affineInverse(m[i]);
+        }
+    });
+}
+
+/**
+ * Computes the normal matrix of each transform, the inverse transpose of its upper 3x3, which
+ * keeps normals perpendicular to surfaces under non-uniform scales.
+ */
+inline void normalMatrices(const simd_float4x4* m, size_t count, simd_float3x3* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = inverseTranspose(m[i]);
+        }
+    });
+}
+
+/** Converts each unit quaternion to a rotation matrix. */
+inline void rotationMatrices(const simd_quatf* q, size_t count, simd_float3x3* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = simd_matrix3x3(q[i]);
+        }
+    });
+}
+
+/** The transform applying a scale, then a rotation, then a translation. */
+inline simd_float4x4 composeTRS(simd_float3 t, simd_quatf r, simd_float3 s) {
+    simd_float3x3 const rotation = simd_matrix3x3(r);
+    return simd_matrix(simd_make_float4(rotation.columns[0] * s.x, 0),
+            simd_make_float4(rotation.columns[1] * s.y, 0),
+            simd_make_float4(rotation.columns[2] * s.z, 0),
+            simd_make_float4(t, 1));
+}
+
+/** Composes translations, rotations and scales into transforms. */
+inline void composeTRS(const simd_float3* t, const simd_quatf* r, const simd_float3* s, size_t count,
+        simd_float4x4* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = composeTRS(t[i], r[i], s[i]);
+        }
+    });
+}
+
+namespace quat {
+
+// Coefficients of the polynomial approximating the weights of slerp, after "A Fast and Accurate
+// Algorithm for Computing SLERP" by David Eberly. The last pair is scaled to balance the error
+// of the weights, which stays under 1e-6 between rotations up to 120 degrees apart, as between
+// keyframes, and under 3e-5 otherwise.
+constexpr float ONE_PLUS_MU = 1.90110745351730037f;
+constexpr float U[8] = { 1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+        1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), ONE_PLUS_MU / (8 * 17) };
+constexpr float V[8] = { 1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+        5.0f / 11, 6.0f / 13, 7.0f / 15, ONE_PLUS_MU * 8 / 17 };
+
+/**
+ * The weight of the end quaternion when slerping by `t` between unit quaternions whose dot
+ * product is `cosine`, with 0 <= cosine <= 1. The start quaternion is weighted by
+ * `slerpWeight(1 - t, cosine)`.
+ */
+template<typename F>
+F slerpWeight(F t, F cosine) {
+    F const tt = t * t;
+    F const c = cosine - 1.0f;
+    F w = 1.0f + (U[7] * tt - V[7]) * c;
+    for (int i = 6; i >= 0; i--) {
+        w = 1.0f + (U[i] * tt - V[i]) * c * w;
+    }
+    return t * w;
+}
+
+// Negates the lanes of x where negative is set, written once for scalars and eight lanes.
+inline float negateIf(bool negative, float x) { return negative ? -x : x; }
+inline simd_float8 negateIf(simd_int8 negative, simd_float8 x) {
+    return (simd_float8) ((simd_int8) x ^ (negative & INT32_MIN));
+}
+
+inline float inverseLength(float lengthSquared) { return 1.0f / std::sqrt(lengthSquared); }
+inline simd_float8 inverseLength(simd_float8 lengthSquared) { return 1.0f / simd_sqrt(lengthSquared); }
+
+}
+
+/** Interpolates along the shortest arc between unit quaternions, at constant angular speed. */
+inline simd_quatf slerp(simd_quatf a, simd_quatf b, float t) {
+    float const cosine = simd_dot(a.vector, b.vector);
+    simd_float4 const end = cosine < 0 ? -b.vector : b.vector;
+    float const c = std::abs(cosine);
+    return simd_quaternion(a.vector * quat::slerpWeight(1.0f - t, c) + end * quat::slerpWeight(t, c));
+}
+
+/**
+ * Interpolates linearly between unit quaternions along the shortest arc and normalizes the
+ * result. Cheaper than slerp, but the angular speed is not constant.
+ */
+inline simd_quatf nlerp(simd_quatf a, simd_quatf b, float t) {
+    float const cosine = simd_dot(a.vector, b.vector);
+    simd_float4 const end = cosine < 0 ? -b.vector : b.vector;
+    return simd_quaternion(simd_normalize(a.vector * (1.0f - t) + end * t));
+}
+
+/** Slerps each pair of quaternions by the same amount. */
+inline void slerp(const simd_quatf* a, const simd_quatf* b, float t, size_t count, simd_quatf* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = slerp(a[i], b[i], t);
+        }
+    });
+}
+
+/** Nlerps each pair of quaternions by the same amount. */
+inline void nlerp(const simd_quatf* a, const simd_quatf* b, float t, size_t count, simd_quatf* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            result[i] = nlerp(a[i], b[i], t);
+        }
+    });
+}
+
+/**
+ * Poses of nodes are stored as ten arrays of `stride` floats, one per component: translations
+ * x, y, z, then rotations x, y, z, w, then scales x, y, z.
+ */
+constexpr size_t POSE_COMPONENTS = 10;
+
+namespace pose {
+
+// Loads and stores one scalar or eight lanes.
+inline void loadLanes(const float* p, float& v) { v = *p; }
+inline void loadLanes(const float* p, simd_float8& v) { v = load8(p); }
+inline void storeLanes(float* p, float v) { *p = v; }
+inline void storeLanes(float* p, simd_float8 v) { store8(p, v); }
+
+template<typename F>
+void interpolate(const float* a, const float* b, size_t stride, size_t i, float t, bool slerp,
+        float* result) {
+    auto const component = [=](const float* pose, size_t c) {
+        F v;
+        loadLanes(pose + c * stride + i, v);
+        return v;
+    };
+    for (size_t c : { 0, 1, 2, 7, 8, 9 }) {
+        storeLanes(result + c * stride + i, component(a, c) + (component(b, c) - component(a, c)) * t);
+    }
+    F const ax = component(a, 3), ay = component(a, 4), az = component(a, 5), aw = component(a, 6);
+    F bx = component(b, 3), by = component(b, 4), bz = component(b, 5), bw = component(b, 6);
+    F cosine = ax * bx + ay * by + az * bz + aw * bw;
+    // take the shortest arc
+    auto const negative = cosine < 0.0f;
+    bx = quat::negateIf(negative, bx);
+    by = quat::negateIf(negative, by);
+    bz = quat::negateIf(negative, bz);
+    bw = quat::negateIf(negative, bw);
+    cosine = quat::negateIf(negative, cosine);
+    F wa, wb;
+    if (slerp) {
+        wa = quat::slerpWeight(F{} + (1.0f - t), cosine);
+        wb = quat::slerpWeight(F{} + t, cosine);
+    } else {
+        wa = F{} + (1.0f - t);
+        wb = F{} + t;
+        // |wa * a + wb * b|^2 for unit quaternions
+        F const scale = quat::inverseLength(wa * wa + wb * wb + 2.0f * wa * wb * cosine);
+        wa *= scale;
+        wb *= scale;
+    }
+    storeLanes(result + 3 * stride + i, ax * wa + bx * wb);
+    storeLanes(result + 4 * stride + i, ay * wa + by * wb);
+    storeLanes(result + 5 * stride + i, az * wa + bz * wb);
+    storeLanes(result + 6 * stride + i, aw * wa + bw * wb);
+}
+
+inline float lane(float v, int) { return v; }
+inline float lane(simd_float8 v, int k) { return v[k]; }
+
+template<typename F, int LANES>
+void compose(const float* const* components, size_t i, simd_float4x4* result) {
+    auto const component = [=](size_t c) {
+        F v;
+        loadLanes(components[c] + i, v);
+        return v;
+    };
+    F const x = component(3), y = component(4), z = component(5), w = component(6);
+    F const sx = component(7), sy = component(8), sz = component(9);
+    F const xx = x * x, yy = y * y, zz = z * z;
+    F const xy = x * y, xz = x * z, yz = y * z;
+    F const wx = w * x, wy = w * y, wz = w * z;
+    F const m[9] = {
+        (1.0f - 2.0f * (yy + zz)) * sx, 2.0f * (xy + wz) * sx, 2.0f * (xz - wy) * sx,
+        2.0f * (xy - wz) * sy, (1.0f - 2.0f * (xx + zz)) * sy, 2.0f * (yz + wx) * sy,
+        2.0f * (xz + wy) * sz, 2.0f * (yz - wx) * sz, (1.0f - 2.0f * (xx + yy)) * sz
+    };
+    F const tx = component(0), ty = component(1), tz = component(2);
+    for (int k = 0; k < LANES; k++) {
+        result[k] = simd_matrix(
+                simd_make_float4(lane(m[0], k), lane(m[1], k), lane(m[2], k), 0),
+                simd_make_float4(lane(m[3], k), lane(m[4], k), lane(m[5], k), 0),
+                simd_make_float4(lane(m[6], k), lane(m[7], k), lane(m[8], k), 0),
+                simd_make_float4(lane(tx, k), lane(ty, k), lane(tz, k), 1));
+    }
+}
+
+}
+
+/**
+ * Interpolates between two poses of `count` nodes, eight nodes at a time: translations and
+ * scales linearly, rotations along the shortest arc, with slerp or with the cheaper nlerp.
+ * `result` has the same layout and may be `a` or `b`.
+ */
+inline void interpolatePoses(const float* a, const float* b, size_t stride, size_t count, float t,
+        bool slerp, float* result) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        pose::interpolate<simd_float8>(a, b, stride, i, t, slerp, result);
+    }
+    for (; i < count; i++) {
+        pose::interpolate<float>(a, b, stride, i, t, slerp, result);
+    }
+}
+
+/**
+ * Composes the `count` nodes of a pose into transforms, eight nodes at a time. `components`
+ * points to the ten arrays of the pose, which need not be laid out at a common stride.
+ */
+inline void composePoses(const float* const* components, size_t count, simd_float4x4* result) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        pose::compose<simd_float8, 8>(components, i, result + i);
+    }
+    for (; i < count; i++) {
+        pose::compose<float, 1>(components, i, result + i);
+    }
+}
+
+/** Composes the `count` nodes of a pose into transforms, eight nodes at a time. */
+inline void composePoses(const float* pose, size_t stride, size_t count, simd_float4x4* result) {
+    const float* components[POSE_COMPONENTS];
+    for (size_t c = 0; c < POSE_COMPONENTS; c++) {
+        components[c] = pose + c * stride;
+    }
+    composePoses(components, count, result);
+}
+
+
+/** Rounding of floats that cannot be represented exactly as half floats. */
+enum class HalfRounding : uint8_t {
+    NEAREST_EVEN,
+    TOWARD_ZERO
+};
+
+namespace half {
+
+// The conversions below are written once for scalars and for eight lanes at a time.
+inline uint32_t maskOf(bool b) { return 0u - uint32_t(b); }
+inline simd_uint8 maskOf(simd_int8 b) { return (simd_uint8) b; }
+inline float asFloat(uint32_t u) { float f; std::memcpy(&f, &u, sizeof(f)); return f; }
+inline simd_float8 asFloat(simd_uint8 u) { return (simd_float8) u; }
+inline uint32_t asBits(float f) { uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u; }
+inline simd_uint8 asBits(simd_float8 f) { return (simd_uint8) f; }
+inline uint32_t minOf(uint32_t a, uint32_t b) { return std::min(a, b); }
+inline simd_uint8 minOf(simd_uint8 a, simd_uint8 b) { return simd_min(a, b); }
+
+template<typename U>
+U constant(uint32_t value) {
+    return U{} + value;
+}
+
+template<typename U>
+U select(U mask, U a, U b) {
+    return (a & mask) | (b & ~mask);
+}
+
+/**
+ * Converts the bits of floats to the bits of half floats, bit-exact for all values but NaNs,
+ * which become quiet NaNs.
+ */
+template<typename U>
+U fromFloat(U f, HalfRounding rounding) {
+    U const sign = f & 0x80000000u;
+    f ^= sign;
+    U const nan = select(maskOf(f > 0x7f800000u), constant<U>(0x7e00u), constant<U>(0x7c00u));
+    U normal, denormal, overflow;
+    if (rounding == HalfRounding::NEAREST_EVEN) {
+        // adding a float whose exponent puts the ulp at the lowest denormal bit lets the FPU
+        // round the denormal mantissa to nearest even
+        uint32_t const magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        denormal = asBits(asFloat(f) + asFloat(constant<U>(magic))) - magic;
+        U const odd = (f >> 13) & 1u;
+        normal = (f + ((15u - 127u) << 23) + 0xfffu + odd) >> 13;
+        // finite values from 65520 up round to infinity
+        overflow = nan;
+    } else {
+        U const shift = minOf(126u - (f >> 23), constant<U>(31u));
+        denormal = ((f & 0x7fffffu) | 0x800000u) >> shift;
+        normal = (f + ((15u - 127u) << 23)) >> 13;
+        // finite values above the largest half float truncate to it
+        overflow = select(maskOf(f >= 0x7f800000u), nan, constant<U>(0x7bffu));
+    }
+    U const half = select(maskOf(f >= 0x47800000u), overflow,
+            select(maskOf(f < 0x38800000u), denormal, normal));
+    return half | (sign >> 16);
+}
+
+/** Converts the bits of half floats to the bits of floats, which is always exact. */
+template<typename U>
+U toFloat(U h) {
+    U bits = (h & 0x7fffu) << 13;
+    U const exponent = bits & 0x0f800000u;
+    bits += (127u - 15u) << 23;
+    bits = select(maskOf(exponent == 0x0f800000u), bits + ((128u - 16u) << 23), bits);
+    U const renormalized = asBits(asFloat(bits + (1u << 23)) - asFloat(constant<U>(113u << 23)));
+    bits = select(maskOf(exponent == 0u), renormalized, bits);
+    return bits | ((h & 0x8000u) << 16);
+}
+
+}
+
+/**
+ * Converts floats to half floats. Rounding to nearest even uses the CPU's conversion
+ * instructions when available.
+ */
+inline void floatsToHalves(const float* values, size_t count, uint16_t* result,
+        HalfRounding rounding = HalfRounding::NEAREST_EVEN) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        size_t i = first;
+        for (; i + 8 <= last; i += 8) {
+#if defined(__aarch64__)
+            if (rounding == HalfRounding::NEAREST_EVEN) {
+                float16x8_t const halves = vcombine_f16(vcvt_f16_f32(vld1q_f32(values + i)),
+                        vcvt_f16_f32(vld1q_f32(values + i + 4)));
+                vst1q_u16(result + i, vreinterpretq_u16_f16(halves));
+                continue;
+            }
+#elif defined(__F16C__)
+            __m256 const floats = _mm256_loadu_ps(values + i);
+            _mm_storeu_si128((__m128i*) (result + i), rounding == HalfRounding::NEAREST_EVEN
+                    ? _mm256_cvtps_ph(floats, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+                    : _mm256_cvtps_ph(floats, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+            continue;
+#endif
+            simd_uint8 const halves = half::fromFloat(half::asBits(load8(values + i)), rounding);
+            simd_ushort8 const packed = __builtin_convertvector(halves, simd_ushort8);
+            std::memcpy(result + i, &packed, sizeof(packed));
+        }
+        for (; i < last; i++) {
+            result[i] = uint16_t(half::fromFloat(half::asBits(values[i]), rounding));
+        }
+    });
+}
+
+/** Converts half floats to floats, which is always exact. */
+inline void halvesToFloats(const uint16_t* values, size_t count, float* result) {
+    parallelFor(count, [=](size_t first, size_t last) {
+        size_t i = first;
+        for (; i + 8 <= last; i += 8) {
+#if defined(__aarch64__)
+            float16x8_t const halves = vreinterpretq_f16_u16(vld1q_u16(values + i));
+            vst1q_f32(result + i, vcvt_f32_f16(vget_low_f16(halves)));
+            vst1q_f32(result + i + 4, vcvt_f32_f16(vget_high_f16(halves)));
+#elif defined(__F16C__)
+            _mm256_storeu_ps(result + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (values + i))));
+#else
+            simd_ushort8 packed;
+            std::memcpy(&packed, values + i, sizeof(packed));
+            simd_uint8 const halves = __builtin_convertvector(packed, simd_uint8);
+            store8(result + i, half::asFloat(half::toFloat(halves)));
+#endif
+        }
+        for (; i < last; i++) {
+            result[i] = half::asFloat(half::toFloat(uint32_t(values[i])));
+        }
+    });
+}
+
+}
+
+#endif /* Kernels_h */
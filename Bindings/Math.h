@@ -38,6 +38,13 @@
          m.columns[1][0], m.columns[1][1], m.columns[1][2], m.columns[1][3], \
          m.columns[2][0], m.columns[2][1], m.columns[2][2], m.columns[2][3], \
          m.columns[3][0], m.columns[3][1], m.columns[3][2], m.columns[3][3]))
+// simd_float4x4 and mat4f are both four 16-byte aligned float4 columns, so arrays of one can
+// be read as arrays of the other without any conversion.
+static_assert(sizeof(simd_float4x4) == sizeof(filament::math::mat4f), "simd_float4x4 must match mat4f");
+#define MAT4F_ARRAY_FROM_SIMD(m) (reinterpret_cast<const filament::math::mat4f*>(m))
+// A RenderableManager::Bone is a unit quaternion followed by a translation and a padding float,
+// i.e. two float4 rows.
+#define BONES_FROM_SIMD(m) (reinterpret_cast<const filament::RenderableManager::Bone*>(m))
 #define FROM_BOX(box) (filament::Box{ FLOAT3_FROM_SIMD(box.center), FLOAT3_FROM_SIMD(box.halfExtent) })
 #define TO_BOX(box) [[Box alloc] initWithVector:SIMD_DOUBLE3_FROM_FLOAT3(box.center) Extent:SIMD_DOUBLE3_FROM_FLOAT3(box.halfExtent)];
 
@@ -0,0 +1,120 @@
+//
+//  Scratch.h
+//
+//  Per-thread scratch memory for temporary arrays built by the bindings.
+//
+
+#ifndef Scratch_h
+#define Scratch_h
+
+#include <utils/Allocator.h>
+
+#include <algorithm>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bindings {
+
+/** Usage of a thread's scratch arena since its statistics were last reset. */
+struct ScratchStatistics {
+    // most bytes of the area in use at once
+    size_t highWaterMark = 0;
+    // allocations that did not fit in the area and spilled to the heap
+    size_t heapAllocationCount = 0;
+    size_t heapByteCount = 0;
+    // allocations refused by tryAllocate
+    size_t refusedCount = 0;
+};
+
+/**
+ * Scoped access to the calling thread's scratch arena.
+ *
+ * Allocations are carved linearly out of a fixed area and only spill to the heap once it is
+ * exhausted, unless made with tryAllocate. Nested scopes rewind to where they started, acting as
+ * markers; the outermost scope resets the arena, which also frees any heap spills, so memory
+ * stays bounded and is reused across calls, or across frames when a scope spans a frame.
+ * Allocations must not outlive the scope that made them.
+ *
+ * Each thread records the high-water mark of its area and its heap spills, to size AREA_SIZE.
+ */
+class ScratchScope {
+public:
+    static constexpr size_t AREA_SIZE = 256 * 1024;
+
+    ScratchScope() noexcept : mState(state()), mRewind(mState.arena.getCurrent()) {
+        mState.depth++;
+    }
+
+    ~ScratchScope() noexcept {
+        if (--mState.depth == 0) {
+            mState.arena.reset();
+        } else {
+            mState.arena.rewind(mRewind);
+        }
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    /** Allocates `count` elements, from the heap if they do not fit in the area. */
+    template<typename T>
+    T* allocate(size_t count) noexcept {
+        T* const p = mState.arena.template alloc<T>(count);
+        mState.record(p, count * sizeof(T));
+        return p;
+    }
+
+    /** Allocates `count` elements from the area, or returns null if they do not fit. */
+    template<typename T>
+    T* tryAllocate(size_t count) noexcept {
+        auto const& area = mState.arena.getArea();
+        char* const first = utils::pointermath::align((char*) mState.arena.getCurrent(), alignof(T));
+        if (first + count * sizeof(T) > (char*) area.end()) {
+            mState.statistics.refusedCount++;
+            return nullptr;
+        }
+        return allocate<T>(count);
+    }
+
+    /** The statistics of the calling thread's arena. */
+    static ScratchStatistics statistics() noexcept {
+        return state().statistics;
+    }
+
+    /** Resets the statistics of the calling thread's arena. */
+    static void resetStatistics() noexcept {
+        state().statistics = {};
+    }
+
+private:
+    using Arena = utils::Arena<utils::LinearAllocatorWithFallback, utils::LockingPolicy::NoLock>;
+
+    struct State {
+        Arena arena{ "bindings::scratch", AREA_SIZE };
+        uint32_t depth = 0;
+        ScratchStatistics statistics;
+
+        void record(void* p, size_t size) noexcept {
+            if (arena.getAllocator().isHeapAllocation(p)) {
+                statistics.heapAllocationCount++;
+                statistics.heapByteCount += size;
+            } else {
+                size_t const used = (char*) arena.getCurrent() - (char*) arena.getArea().begin();
+                statistics.highWaterMark = std::max(statistics.highWaterMark, used);
+            }
+        }
+    };
+
+    static State& state() noexcept {
+        static thread_local State s;
+        return s;
+    }
+
+    State& mState;
+    void* mRewind;
+};
+
+}
+
+#endif /* Scratch_h */
@@ -0,0 +1,82 @@
+//
+//  Transactions.h
+//
+//  Local transform transactions shared between the bindings and their callers.
+//
+
+#ifndef Transactions_h
+#define Transactions_h
+
+#include <filament/TransformManager.h>
+
+#include <tsl/robin_set.h>
+
+#include <mutex>
+
+namespace bindings {
+
+/**
+ * Records which transform managers have a local transform transaction opened through
+ * TransformManager, since Filament does not tell. Batched updates use it to leave an open
+ * transaction to its owner instead of committing it early.
+ */
+class LocalTransformTransactions {
+public:
+    static void setOpen(const filament::TransformManager* manager, bool open) {
+        auto& s = state();
+        std::lock_guard<std::mutex> guard(s.lock);
+        if (open) {
+            s.open.insert(manager);
+        } else {
+            s.open.erase(manager);
+        }
+    }
+
+    static bool isOpen(const filament::TransformManager* manager) {
+        auto& s = state();
+        std::lock_guard<std::mutex> guard(s.lock);
+        return s.open.find(manager) != s.open.end();
+    }
+
+private:
+    struct State {
+        std::mutex lock;
+        tsl::robin_set<const filament::TransformManager*> open;
+    };
+
+    static State& state() {
+        static State* const s = new State();
+        return *s;
+    }
+};
+
+/**
+ * Scoped local transform transaction, which is only opened and committed if the caller does not
+ * already have one open, in which case the updates become part of it.
+ */
+class LocalTransformTransaction {
+public:
+    explicit LocalTransformTransaction(filament::TransformManager& manager)
+            : mManager(manager), mOwned(!LocalTransformTransactions::isOpen(&manager)) {
+        if (mOwned) {
+            mManager.openLocalTransformTransaction();
+        }
+    }
+
+    ~LocalTransformTransaction() {
+        if (mOwned) {
+            mManager.commitLocalTransformTransaction();
+        }
+    }
+
+    LocalTransformTransaction(const LocalTransformTransaction&) = delete;
+    LocalTransformTransaction& operator=(const LocalTransformTransaction&) = delete;
+
+private:
+    filament::TransformManager& mManager;
+    bool const mOwned;
+};
+
+}
+
+#endif /* Transactions_h */
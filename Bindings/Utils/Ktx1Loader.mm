@@ -9,67 +9,269 @@
 #import <filament/IndirectLight.h>
 #import <filament/Skybox.h>
 #import "../Math.h"
+#import "../Buffers.h"
+#import "../Wrappers.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+/**
+ * A KTX1 container parsed in place.
+ *
+ * Ktx1Bundle copies every image into its own storage when it is parsed, which doubles the
+ * memory needed to load a file. This only records where the images are within the original
+ * bytes, so they can be handed to the engine directly.
+ */
+struct Ktx1View {
+    image::KtxInfo info{};
+    uint32_t levels = 0;
+    uint32_t faces = 0;
+    const uint8_t* metadata = nullptr;
+    uint32_t metadataSize = 0;
+    const uint8_t* images = nullptr;
+    const uint8_t* end = nullptr;
+
+    static constexpr uint8_t IDENTIFIER[12] = {
+        0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+    };
+
+    // sizes are computed in 64 bits, where sizes read from the file cannot wrap around
+    static uint64_t align4(uint64_t size) {
+        return (size + 3u) & ~uint64_t(3);
+    }
+
+    static uint32_t read(const uint8_t* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    bool parse(const uint8_t* bytes, size_t length) {
+        constexpr size_t HEADER_SIZE = sizeof(IDENTIFIER) + 13 * sizeof(uint32_t);
+        if (length < HEADER_SIZE || std::memcmp(bytes, IDENTIFIER, sizeof(IDENTIFIER)) != 0) {
+            return false;
+        }
+        const uint8_t* p = bytes + sizeof(IDENTIFIER);
+        info.endianness = read(p + 0);
+        info.glType = read(p + 4);
+        info.glTypeSize = read(p + 8);
+        info.glFormat = read(p + 12);
+        info.glInternalFormat = read(p + 16);
+        info.glBaseInternalFormat = read(p + 20);
+        info.pixelWidth = read(p + 24);
+        info.pixelHeight = read(p + 28);
+        info.pixelDepth = read(p + 32);
+        uint32_t const arrayElements = read(p + 36);
+        faces = read(p + 40);
+        levels = std::max(read(p + 44), 1u);
+        metadataSize = read(p + 48);
+        if (info.endianness != image::Ktx1Bundle::ENDIAN_DEFAULT || (faces != 1 && faces != 6)) {
+            return false;
+        }
+        // arrays and 3D textures are laid out differently and not supported
+        if (arrayElements > 0 || info.pixelDepth > 0) {
+            return false;
+        }
+        if (metadataSize > length - HEADER_SIZE) {
+            return false;
+        }
+        metadata = bytes + HEADER_SIZE;
+        images = metadata + metadataSize;
+        end = bytes + length;
+        return true;
+    }
+
+    bool isCubemap() const {
+        return faces == 6;
+    }
+
+    /**
+     * Finds the first image of `level` and its size, which is the size of a single face for
+     * cubemaps. Faces are stored one after the other, each padded to 4 bytes.
+     */
+    bool getLevel(uint32_t level, const uint8_t** data, size_t* size) const {
+        const uint8_t* p = images;
+        for (uint32_t i = 0; i <= level; i++) {
+            if (size_t(end - p) < sizeof(uint32_t)) {
+                return false;
+            }
+            uint64_t const imageSize = read(p);
+            p += sizeof(uint32_t);
+            uint64_t const available = uint64_t(end - p);
+            if (imageSize > available) {
+                return false;
+            }
+            uint64_t const levelSize = isCubemap() ? align4(imageSize) * faces : align4(imageSize);
+            if (levelSize > available) {
+                return false;
+            }
+            if (i == level) {
+                *data = p;
+                *size = imageSize;
+                return true;
+            }
+            p += levelSize;
+        }
+        return false;
+    }
+
+    /** Reads the spherical harmonics stored as 27 floats under the "sh" metadata key. */
+    bool getSphericalHarmonics(filament::math::float3* result) const {
+        const uint8_t* p = metadata;
+        const uint8_t* const last = metadata + metadataSize;
+        while (p + sizeof(uint32_t) <= last) {
+            uint32_t const size = read(p);
+            const char* key = (const char*) p + sizeof(uint32_t);
+            if (size > size_t(last - p) - sizeof(uint32_t)) {
+                return false;
+            }
+            size_t const keyLength = strnlen(key, size);
+            if (keyLength < size && std::strcmp(key, "sh") == 0) {
+                std::string const value(key + keyLength + 1, size - keyLength - 1);
+                const char* src = value.c_str();
+                float* flat = &result->x;
+                for (int i = 0; i < 9 * 3; i++) {
+                    char* next;
+                    *flat++ = std::strtof(src, &next);
+                    if (next == src) {
+                        return false;
+                    }
+                    src = next;
+                }
+                return true;
+            }
+            uint64_t const step = sizeof(uint32_t) + align4(size);
+            if (step >= uint64_t(last - p)) {
+                return false;
+            }
+            p += step;
+        }
+        return false;
+    }
+};
+
+/**
+ * Creates a texture from `ktx` and uploads all its levels straight from the bytes of `data`,
+ * which stays retained until the last level has been consumed.
+ */
+filament::Texture* createTexture(filament::Engine* engine, const Ktx1View& ktx, NSData* data, bool srgb) {
+    using filament::Texture;
+    using namespace ktxreader;
+
+    auto const& info = ktx.info;
+    auto format = Ktx1Reader::toTextureFormat(info);
+    if (srgb && format == Texture::InternalFormat::RGB8) {
+        format = Texture::InternalFormat::SRGB8;
+    }
+    if (srgb && format == Texture::InternalFormat::RGBA8) {
+        format = Texture::InternalFormat::SRGB8_A8;
+    }
+    bool const compressed = Ktx1Reader::isCompressed(info);
+
+    Texture* texture = Texture::Builder()
+            .width(info.pixelWidth)
+            .height(info.pixelHeight)
+            .levels(ktx.levels)
+            .sampler(ktx.isCubemap() ? Texture::Sampler::SAMPLER_CUBEMAP : Texture::Sampler::SAMPLER_2D)
+            .format(format)
+            .build(*engine);
+
+    auto const base = (const uint8_t*) data.bytes;
+    for (uint32_t level = 0; level < ktx.levels; level++) {
+        const uint8_t* image;
+        size_t size;
+        if (!ktx.getLevel(level, &image, &size)) {
+            break;
+        }
+        size_t const faceStride = Ktx1View::align4(size);
+        size_t const bytes = ktx.isCubemap() ? faceStride * 5 + size : size;
+        auto buffer = compressed
+                ? bindings::retainedPixelBuffer(data, image - base, bytes,
+                        Ktx1Reader::toCompressedPixelDataType(info))
+                : bindings::retainedPixelBuffer(data, image - base, bytes,
+                        Ktx1Reader::toPixelDataFormat(info), Ktx1Reader::toPixelDataType(info),
+                        1, 0, 0, 0);
+        if (compressed) {
+            // the compressed image size is the size of a single face
+            buffer.imageSize = size;
+        }
+        if (ktx.isCubemap()) {
+            texture->setImage(*engine, level, std::move(buffer), Texture::FaceOffsets(faceStride));
+        } else {
+            texture->setImage(*engine, level, std::move(buffer));
+        }
+    }
+    return texture;
+}
+
+}
 
 @implementation Ktx1Loader
 
++ (NSData *)mapFile:(NSString *)path{
+    return [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:nil];
+}
+
 + (Texture *)createTexture:(Engine *)engine :(NSData *)buffer :(bool)srgb{
-    auto nEngine = (filament::Engine*) engine.engine;
-    
-    auto bundle = ktxreader::Ktx1Bundle((uint8_t*)buffer.bytes, (uint32_t)buffer.length);
-    
-    auto texture = ktxreader::Ktx1Reader::createTexture(nEngine, &bundle, srgb);
-    return [[Texture alloc] init:texture];
+    // mutable data is copied first, as it is referenced until the upload completes
+    NSData* data = [buffer copy];
+    Ktx1View ktx;
+    if (!ktx.parse((const uint8_t*) data.bytes, data.length)) {
+        return nil;
+    }
+    auto texture = createTexture((filament::Engine*) engine.engine, ktx, data, srgb);
+    return bindings::wrap<Texture>(texture, engine.engine);
 }
 
 + (IndirectLight *)createIndirectLight:(Engine *)engine :(NSData *)buffer :(bool)srgb{
+    // mutable data is copied first, as it is referenced until the upload completes
+    NSData* data = [buffer copy];
+    Ktx1View ktx;
+    if (!ktx.parse((const uint8_t*) data.bytes, data.length)) {
+        return nil;
+    }
     auto nEngine = (filament::Engine*) engine.engine;
-    auto bytes = (uint8_t*) buffer.bytes;
-    auto length = (uint32_t) buffer.length;
-    
-    auto bundle = new ktxreader::Ktx1Bundle(bytes, length);
-    
-    auto texture = ktxreader::Ktx1Reader::createTexture(nEngine, bundle, srgb);
+    auto texture = createTexture(nEngine, ktx, data, srgb);
+    auto builder = filament::IndirectLight::Builder();
+    builder.reflections(texture).intensity(30000);
     filament::math::float3 harmonics[9];
-    bundle->getSphericalHarmonics(harmonics);
-    
-    auto light = filament::IndirectLight::Builder()
-        .reflections(texture)
-        .irradiance(3, harmonics)
-        .intensity(30000)
-        .build(*nEngine)
-    ;
-    return [[IndirectLight alloc] init:light];
+    if (ktx.getSphericalHarmonics(harmonics)) {
+        builder.irradiance(3, harmonics);
+    }
+    auto light = builder.build(*nEngine);
+    return bindings::wrap<IndirectLight>(light, engine.engine);
 }
 
 + (Skybox *)createSkybox:(Engine *)engine :(NSData *)buffer :(bool)srgb{
+    // mutable data is copied first, as it is referenced until the upload completes
+    NSData* data = [buffer copy];
+    Ktx1View ktx;
+    if (!ktx.parse((const uint8_t*) data.bytes, data.length)) {
+        return nil;
+    }
     auto nEngine = (filament::Engine*) engine.engine;
-    auto bytes = (uint8_t*) buffer.bytes;
-    auto length = (uint32_t) buffer.length;
-    
-    auto bundle = new ktxreader::Ktx1Bundle(bytes, length);
-    const auto deleter = [](void* userdata) {
-        auto* bundle = (ktxreader::Ktx1Bundle*) userdata;
-        delete bundle;
-    };
-    auto texture = ktxreader::Ktx1Reader::createTexture(nEngine, *bundle, srgb, deleter, bundle);
-    
+    auto texture = createTexture(nEngine, ktx, data, srgb);
+
     auto skybox = filament::Skybox::Builder()
         .environment(texture)
         .showSun(true)
         .build(*nEngine);
-    
-    return [[Skybox alloc] init: skybox];
-    
+
+    return bindings::wrap<Skybox>(skybox, engine.engine);
+
 }
 + (simd_double3x3)getSphericalHarmonics:(NSData *)buffer{
-    auto bundle = new ktxreader::Ktx1Bundle((uint8_t*)buffer.bytes, (uint32_t) buffer.length);
-    
-    filament::math::float3 harmonics[9];
-    
-    bundle->getSphericalHarmonics(harmonics);
-    
+    Ktx1View ktx;
+    filament::math::float3 harmonics[9] = {};
+    if (ktx.parse((const uint8_t*) buffer.bytes, buffer.length)) {
+        ktx.getSphericalHarmonics(harmonics);
+    }
     return SIMD_DOUBLE3X3_FROM_MAT3X3(harmonics);
-    
+
 }
 
 @end
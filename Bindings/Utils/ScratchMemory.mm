@@ -0,0 +1,33 @@
+//
+//  ScratchMemory.mm
+//
+#import "Bindings/Utils/ScratchMemory.h"
+#import "../Scratch.h"
+
+@implementation ScratchMemory
+
++ (size_t)getAreaSize{
+    return bindings::ScratchScope::AREA_SIZE;
+}
+
++ (size_t)getHighWaterMark{
+    return bindings::ScratchScope::statistics().highWaterMark;
+}
+
++ (size_t)getHeapAllocationCount{
+    return bindings::ScratchScope::statistics().heapAllocationCount;
+}
+
++ (size_t)getHeapByteCount{
+    return bindings::ScratchScope::statistics().heapByteCount;
+}
+
++ (size_t)getRefusedCount{
+    return bindings::ScratchScope::statistics().refusedCount;
+}
+
++ (void)resetStatistics{
+    bindings::ScratchScope::resetStatistics();
+}
+
+@end
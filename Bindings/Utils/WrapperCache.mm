@@ -0,0 +1,147 @@
+//
+//  WrapperCache.mm
+//
+#import "Bindings/Utils/WrapperCache.h"
+#import "../Wrappers.h"
+
+#include <tsl/robin_map.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+
+// Dead entries are swept once the table has grown this much since the last sweep.
+constexpr size_t SWEEP_MIN_SIZE = 64;
+
+struct Entry {
+    // weak, so the table never keeps a wrapper alive after its last user, even when its native
+    // object is destroyed without going through the bindings
+    __weak id wrapper;
+    Class cls;
+    const void* owner;
+};
+
+struct Cache {
+    std::mutex lock;
+    tsl::robin_map<const void*, Entry> wrappers;
+    size_t sweepSize = SWEEP_MIN_SIZE;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    // erases the entries whose wrapper was deallocated, in amortized constant time per insertion
+    void sweep() {
+        if (wrappers.size() < sweepSize) {
+            return;
+        }
+        for (auto pos = wrappers.begin(); pos != wrappers.end();) {
+            if (pos->second.wrapper == nil) {
+                pos = wrappers.erase(pos);
+            } else {
+                ++pos;
+            }
+        }
+        sweepSize = std::max(wrappers.size() * 2, SWEEP_MIN_SIZE);
+    }
+};
+
+Cache& cache() {
+    static Cache* const c = new Cache();
+    return *c;
+}
+
+}
+
+namespace bindings {
+
+id findWrapper(const void* native, const void* owner, Class cls) {
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    auto pos = c.wrappers.find(native);
+    if (pos != c.wrappers.end() && pos->second.cls == cls) {
+        id const wrapper = pos->second.wrapper;
+        if (wrapper) {
+            // the wrapper may have been first handed out by a getter that did not know the owner
+            if (!pos->second.owner) {
+                pos.value().owner = owner;
+            }
+            c.hits++;
+            return wrapper;
+        }
+    }
+    c.misses++;
+    return nil;
+}
+
+id internWrapper(const void* native, const void* owner, id wrapper) {
+    auto& c = cache();
+    Class const cls = [wrapper class];
+    std::lock_guard<std::mutex> guard(c.lock);
+    auto pos = c.wrappers.find(native);
+    if (pos != c.wrappers.end()) {
+        id const interned = pos->second.wrapper;
+        if (interned && pos->second.cls == cls) {
+            if (!pos->second.owner) {
+                pos.value().owner = owner;
+            }
+            return interned;
+        }
+        // the wrapper was deallocated, or the address was reused by an object of another type
+        pos.value() = { wrapper, cls, owner };
+        return wrapper;
+    }
+    c.sweep();
+    c.wrappers.insert({ native, { wrapper, cls, owner }});
+    return wrapper;
+}
+
+void forgetWrapper(const void* native) {
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    c.wrappers.erase(native);
+}
+
+void forgetWrappersOwnedBy(const void* owner) {
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    c.wrappers.erase(owner);
+    for (auto pos = c.wrappers.begin(); pos != c.wrappers.end();) {
+        if (pos->second.owner == owner) {
+            pos = c.wrappers.erase(pos);
+        } else {
+            ++pos;
+        }
+    }
+}
+
+}
+
+@implementation WrapperCache
+
++ (uint64_t)getHitCount{
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    return c.hits;
+}
++ (uint64_t)getMissCount{
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    return c.misses;
+}
++ (size_t)getSize{
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    size_t size = 0;
+    for (auto const& entry : c.wrappers) {
+        size += entry.second.wrapper != nil;
+    }
+    return size;
+}
++ (void)resetCounters{
+    auto& c = cache();
+    std::lock_guard<std::mutex> guard(c.lock);
+    c.hits = 0;
+    c.misses = 0;
+}
+
+@end
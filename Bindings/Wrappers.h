@@ -0,0 +1,56 @@
+//
+//  Wrappers.h
+//
+//  Interning of the Objective-C wrappers created around native handles.
+//
+
+#ifndef Wrappers_h
+#define Wrappers_h
+
+#import <Foundation/Foundation.h>
+
+namespace bindings {
+
+/**
+ * Returns the wrapper interned for `native` if it is an instance of `cls`, or nil, recording
+ * `owner` if the wrapper has none yet. Lookups are counted as hits or misses, see WrapperCache.
+ */
+id findWrapper(const void* native, const void* owner, Class cls);
+
+/**
+ * Interns `wrapper` for `native` and returns it, or returns the wrapper another thread interned
+ * first. Wrappers interned with an `owner` are dropped by forgetWrappersOwnedBy(owner), which
+ * is the object destroying them along with itself: the engine for the objects it creates, the
+ * asset for the instances, animators and material instances of its instances.
+ *
+ * The table only holds wrappers weakly, so it does not keep wrappers alive by itself.
+ */
+id internWrapper(const void* native, const void* owner, id wrapper);
+
+/** Drops the wrapper interned for `native`, which is about to be destroyed. */
+void forgetWrapper(const void* native);
+
+/** Drops the wrapper interned for `owner` and every wrapper interned with it as owner. */
+void forgetWrappersOwnedBy(const void* owner);
+
+/**
+ * Returns the unique wrapper for `native`, creating it with `-init:` the first time.
+ *
+ * Wrappers only hold their native pointer, so handing out the same one for the same handle
+ * avoids allocating a new object on every call of a getter and keeps `===` meaningful.
+ * Returns nil for a null handle.
+ */
+template<typename Wrapper>
+Wrapper* wrap(const void* native, const void* owner = nullptr) {
+    if (!native) {
+        return nil;
+    }
+    if (id cached = findWrapper(native, owner, [Wrapper class])) {
+        return cached;
+    }
+    return internWrapper(native, owner, [[Wrapper alloc] init:(void*) native]);
+}
+
+}
+
+#endif /* Wrappers_h */
@@ -0,0 +1,57 @@
+//
+//  AnimationStaging.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "Entity.h"
+
+#ifndef AnimationStaging_h
+#define AnimationStaging_h
+
+@class RenderableManager;
+
+/**
+ * Double-buffered CPU staging area for per-frame bone and morph weight updates.
+ *
+ * <p>Updates for any number of renderables are copied into the back buffer, then applied to a
+ * {@link RenderableManager} in a single pass by {@link #flush}. Flushing swaps the buffers
+ * first, so other threads can keep staging the next frame while the previous one is being
+ * applied. Both buffers keep their capacity, so a steady animation load stages without
+ * allocating.</p>
+ *
+ * <p>Staging methods may be called from any thread; {@link #flush} must be called on the
+ * thread that owns the engine.</p>
+ */
+NS_SWIFT_NAME(RenderableManager.AnimationStaging)
+@interface AnimationStaging : NSObject
+
+- (nonnull id) init;
+
+/**
+ * Stages bone transforms given as two float4 rows per bone (unit quaternion, translation).
+ *
+ * @see RenderableManager#setBones
+ */
+- (void) stageBones: (EntityInstance) instance :(nonnull const simd_float4*) transforms :(size_t) boneCount :(size_t) offset;
+/**
+ * Stages bone transforms given as 4x4 matrices.
+ *
+ * @see RenderableManager#setBoneMatrices
+ */
+- (void) stageBoneMatrices: (EntityInstance) instance :(nonnull const simd_float4x4*) transforms :(size_t) boneCount :(size_t) offset;
+/**
+ * Stages morph target weights.
+ *
+ * @see RenderableManager#setMorphWeights
+ */
+- (void) stageMorphWeights: (EntityInstance) instance :(nonnull const float*) weights :(size_t) count :(size_t) offset;
+/**
+ * Applies every update staged since the previous flush, in staging order.
+ *
+ * @return The number of updates applied.
+ */
+- (size_t) flush: (nonnull RenderableManager*) manager;
+
+@end
+
+#endif /* AnimationStaging_h */
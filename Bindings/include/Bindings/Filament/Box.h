@@ -17,6 +17,18 @@ typedef struct{
     simd_float3 min;
     simd_float3 max;
 } Aabb;
+/**
+ * Boxes stored as one array per coordinate, for batch operations such as
+ * {@link BoxBatch#transformAll} or {@link Frustum#intersectBoxes}.
+ */
+typedef struct{
+    float* _Nonnull centerX;
+    float* _Nonnull centerY;
+    float* _Nonnull centerZ;
+    float* _Nonnull halfExtentX;
+    float* _Nonnull halfExtentY;
+    float* _Nonnull halfExtentZ;
+} BoxArrays;
 
 
 #endif /* Box_h */
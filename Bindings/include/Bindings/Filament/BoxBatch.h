@@ -0,0 +1,35 @@
+//
+//  BoxBatch.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "Box.h"
+
+#ifndef BoxBatch_h
+#define BoxBatch_h
+
+/**
+ * Transforms of many bounding boxes at once.
+ *
+ * <p>Each box is replaced by the axis-aligned bounding box of its transformed corners, like
+ * <code>Box.transform</code>. Matrices are affine transforms. Large batches are spread over the
+ * CPU cores. Results may be written over the source boxes.</p>
+ */
+@interface BoxBatch : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+- (id) init NS_UNAVAILABLE;
+
+/** Transforms each of <code>count</code> boxes by the matrix at the same index. */
++ (void) transform: (const simd_float4x4*) matrices :(const Box*) boxes :(size_t) count :(Box*) result;
+/** Transforms each of <code>count</code> boxes stored as arrays by the matrix at the same index. */
++ (void) transformArrays: (const simd_float4x4*) matrices :(BoxArrays) boxes :(size_t) count :(BoxArrays) result;
+/** Transforms <code>count</code> boxes stored as arrays by the same matrix, eight at a time. */
++ (void) transformAll: (simd_float4x4) matrix :(BoxArrays) boxes :(size_t) count :(BoxArrays) result;
+/** Returns the bounding box of <code>count</code> boxes, or an empty box if there are none. */
++ (Box) unionOf: (const Box*) boxes :(size_t) count;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* BoxBatch_h */
@@ -25,6 +25,19 @@
  */
 - (void) setBuffer: (nonnull Engine*) engine :(nonnull NSData*) buffer :(uint32_t) byteOffset;
 
+/**
+ * Asynchronously initializes a region of this BufferObject directly from the bytes of the data
+ * provided.
+ *
+ * Unlike setBuffer, no intermediate copy is made: the data is retained and released once
+ * Filament has consumed it. The contents must not be mutated until then.
+ *
+ * @param engine Reference to the filament::Engine associated with this BufferObject.
+ * @param buffer The data used to initialize the BufferObject.
+ * @param byteOffset Offset in bytes into the BufferObject
+ */
+- (void) setBufferNoCopy: (nonnull Engine*) engine :(nonnull NSData*) buffer :(uint32_t) byteOffset;
+
 /**
  * Returns the size of this BufferObject in elements.
  * @return The maximum capacity of the BufferObject.
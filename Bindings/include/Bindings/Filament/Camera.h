@@ -5,6 +5,7 @@
 //
 #import <Foundation/Foundation.h>
 #import <simd/simd.h>
+#import "Frustum.h"
 
 #ifndef Camera_h
 #define Camera_h
@@ -386,6 +387,13 @@ typedef NS_ENUM(NSInteger, Fov) {
 
 - (simd_double4x4) getViewMatrix;
 
+/**
+ * Retrieves the camera's frustum in world space, built from its culling projection matrix.
+ *
+ * @return A new Frustum, which is not updated when the camera changes
+ */
+- (nonnull Frustum*) getFrustum;
+
 
 - (simd_double3) getPosition;
 
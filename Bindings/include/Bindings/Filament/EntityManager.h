@@ -20,6 +20,25 @@
 - (void) destroy: (Entity) entity;
 - (bool) isAlive: (Entity) entity;
 
+/** Creates <code>count</code> entities, taking the lock of the manager once. */
+- (void) create: (size_t) count :(nonnull Entity*) entities;
+/** Destroys <code>count</code> entities, taking the lock of the manager once. */
+- (void) destroy: (nonnull const Entity*) entities :(size_t) count;
+
+/**
+ * Creates an entity from the calling thread's reservation, a block of entities created at
+ * once and handed out without locking. Loader threads creating many entities concurrently
+ * then only contend once per block.
+ *
+ * <p>Reserved entities are alive, so they can be used by any thread once handed out. Those
+ * left over are destroyed by {@link #releaseReservation} or when the thread exits.</p>
+ */
+- (Entity) createReserved;
+/** Creates <code>count</code> entities from the calling thread's reservation. */
+- (void) createReserved: (size_t) count :(nonnull Entity*) entities;
+/** Destroys the entities left in the calling thread's reservation. */
+- (void) releaseReservation;
+
 + (nonnull instancetype) get;
 @end
 
@@ -0,0 +1,74 @@
+//
+//  Frustum.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "Box.h"
+
+#ifndef Frustum_h
+#define Frustum_h
+
+NS_SWIFT_NAME(Frustum.Plane)
+typedef NS_ENUM(NSInteger, FrustumPlane) {
+    FrustumPlaneLeft,
+    FrustumPlaneRight,
+    FrustumPlaneBottom,
+    FrustumPlaneTop,
+    FrustumPlaneFar,
+    FrustumPlaneNear
+};
+
+/**
+ * A frustum defined by six planes, whose normals point outwards.
+ *
+ * <p>Besides testing volumes one by one, a frustum can test large sets of volumes stored as
+ * separate arrays of coordinates. The batch tests process eight volumes at a time with the
+ * CPU's vector unit and write one visibility bit per volume, in 32-bit words: volume
+ * <code>i</code> is visible when bit <code>i % 32</code> of word <code>i / 32</code> is set, the
+ * same layout as a <code>utils::bitset32</code>. Like the single tests, they may report volumes
+ * just outside a corner of the frustum as visible, but never miss a visible one.</p>
+ */
+@interface Frustum : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Creates a frustum from a projection matrix in GL convention, usually the projection matrix
+ * times the view matrix.
+ */
+- (instancetype) init: (simd_float4x4) projectionView;
+/** Sets the frustum from a projection matrix in GL convention. */
+- (void) setProjection: (simd_float4x4) projectionView;
+
+/**
+ * Returns the equation of a plane with a normalized normal, encoded such as
+ * <code>R.x*x + R.y*y + R.z*z + R.w = 0</code>.
+ */
+- (simd_float4) getNormalizedPlane: (FrustumPlane) plane;
+
+/** Returns whether a box may intersect the frustum, i.e. be visible. */
+- (bool) intersectsBox: (Box) box;
+/** Returns whether a sphere, encoded as a center and a radius, may intersect the frustum. */
+- (bool) intersectsSphere: (simd_float4) sphere;
+/** Returns the maximum signed distance of a point to the frustum, negative if it is inside. */
+- (float) contains: (simd_float3) point;
+
+/**
+ * Tests <code>count</code> boxes given by the coordinates of their centers and half extents.
+ *
+ * @param visibility    Receives <code>(count + 31) / 32</code> words of visibility bits.
+ * @return the number of boxes that may be visible.
+ */
+- (size_t) intersectBoxes: (const float*) centerX :(const float*) centerY :(const float*) centerZ :(const float*) halfExtentX :(const float*) halfExtentY :(const float*) halfExtentZ :(size_t) count :(uint32_t*) visibility;
+
+/**
+ * Tests <code>count</code> spheres given by the coordinates of their centers and their radii.
+ *
+ * @param visibility    Receives <code>(count + 31) / 32</code> words of visibility bits.
+ * @return the number of spheres that may be visible.
+ */
+- (size_t) intersectSpheres: (const float*) centerX :(const float*) centerY :(const float*) centerZ :(const float*) radius :(size_t) count :(uint32_t*) visibility;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* Frustum_h */
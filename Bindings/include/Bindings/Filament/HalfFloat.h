@@ -0,0 +1,41 @@
+//
+//  HalfFloat.h
+//
+#import <Foundation/Foundation.h>
+
+#ifndef HalfFloat_h
+#define HalfFloat_h
+
+/** Rounding of floats that cannot be represented exactly as half floats. */
+NS_SWIFT_NAME(HalfFloat.Rounding)
+typedef NS_ENUM(NSInteger, HalfRounding) {
+    /** Rounds to the nearest half float, or the even one in case of a tie, as the GPU does. */
+    HalfRoundingNearestEven,
+    /** Truncates towards zero; finite floats never become infinities. */
+    HalfRoundingTowardZero
+};
+
+/**
+ * Conversions of arrays of floats to and from IEEE 754 half floats, e.g. to fill vertex buffers,
+ * morph targets or RGBA16F textures.
+ *
+ * <p>Conversions use the CPU's half float instructions when available and an equivalent
+ * bit-exact vector fallback otherwise. NaNs stay NaNs but their payload is not preserved. Large
+ * arrays are converted on all the CPU cores.</p>
+ */
+@interface HalfFloat : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+- (id) init NS_UNAVAILABLE;
+
+/** Converts <code>count</code> floats to half floats, rounding to nearest even. */
++ (void) fromFloats: (const float*) values :(size_t) count :(uint16_t*) result;
+/** Converts <code>count</code> floats to half floats. */
++ (void) fromFloats: (const float*) values :(size_t) count :(uint16_t*) result :(HalfRounding) rounding;
+/** Converts <code>count</code> half floats to floats, which is always exact. */
++ (void) toFloats: (const uint16_t*) values :(size_t) count :(float*) result;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* HalfFloat_h */
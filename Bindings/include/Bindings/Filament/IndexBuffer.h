@@ -28,6 +28,20 @@
  */
 - (void) setBuffer: (nonnull Engine*) engine :(nonnull NSData*) buffer :(uint32_t) byteOffset;
 - (void) setBuffer: (nonnull Engine*) engine :(nonnull NSData*) buffer;
+/**
+ * Asynchronously initializes a region of this IndexBuffer directly from the bytes of the data
+ * provided.
+ *
+ * Unlike setBuffer, no intermediate copy is made: the data is retained and released once
+ * Filament has consumed it. The contents must not be mutated until then.
+ *
+ * @param engine Reference to the filament::Engine to associate this IndexBuffer with.
+ * @param buffer Raw data interpreted as either 16-bit or 32-bits indices based on the Type
+ *               of this IndexBuffer.
+ * @param byteOffset Offset in *bytes* into the IndexBuffer
+ */
+- (void) setBufferNoCopy: (nonnull Engine*) engine :(nonnull NSData*) buffer :(uint32_t) byteOffset;
+- (void) setBufferNoCopy: (nonnull Engine*) engine :(nonnull NSData*) buffer;
 /**
  * Returns the size of this IndexBuffer in elements.
  * @return The number of indices the IndexBuffer holds.
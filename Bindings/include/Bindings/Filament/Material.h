@@ -212,6 +212,22 @@ NS_SWIFT_NAME(Material.Parameter)
 @property int count;
 @end
 
+/**
+ * A material parameter resolved once by name.
+ *
+ * Handles are obtained from Material#getParameterHandle and can be used with a
+ * {@link ParameterBlock} to set parameters without converting their name every frame.
+ */
+NS_SWIFT_NAME(Material.ParameterHandle)
+@interface ParameterHandle : NSObject
+@property (nonatomic, readonly, nonnull) NSString* name;
+@property (nonatomic, readonly) ParameterType type;
+@property (nonatomic, readonly) int count;
+@property (nonatomic, readonly, nonnull) const char* nameData NS_SWIFT_UNAVAILABLE("Don't access the raw pointers");
+@property (nonatomic, readonly) size_t nameLength NS_SWIFT_UNAVAILABLE("Don't access the raw pointers");
+- (nonnull id) init NS_UNAVAILABLE;
+@end
+
 @interface Material : NSObject
 
 @property (nonatomic, readonly, nonnull) void* material  NS_SWIFT_UNAVAILABLE("Don't access the raw pointers");
@@ -287,6 +303,14 @@ NS_ASSUME_NONNULL_BEGIN
  * @return The number of parameters written to the parameters pointer.
 */
 - (NSArray<Parameter*>*) getParameters;
+/**
+ * Resolves a parameter of this material by name.
+ *
+ * The returned handle can be reused across frames and across all instances of this material.
+ *
+ * @return The handle, or nil if this material has no parameter of the given name.
+ */
+- (nullable ParameterHandle*) getParameterHandle: (NSString*) name;
 //! Indicates whether a parameter of the given name exists on this material.
 - (bool) hasParameter: (NSString*) name;
 //! Indicates whether an existing parameter is a sampler or not.
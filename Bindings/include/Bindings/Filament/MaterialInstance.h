@@ -12,6 +12,8 @@
 #ifndef MaterialInstance_h
 #define MaterialInstance_h
 
+@class ParameterBlock;
+
 @interface MaterialInstance : NSObject
 
 @property (nonatomic, readonly, nonnull) void* instance  NS_SWIFT_UNAVAILABLE("Don't access the raw pointers");
@@ -47,6 +49,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (void) setParameterMat3f: (NSString*) name :(simd_float3x3) vector;
 - (void) setParameterMat4f: (NSString*) name :(simd_float4x4) vector;
 - (void) setParameterTexture: (NSString*) name :(Texture*) texture :(TextureSampler*) sampler;
+/**
+ * Sets all the parameters held by a {@link ParameterBlock} in one call.
+ *
+ * @param block Values keyed by handles resolved against this instance's material.
+ */
+- (void) setParameters: (ParameterBlock*) block;
 #warning Add Color Parameters
 /**
  * Set up a custom scissor rectangle; by default this encompasses the View.
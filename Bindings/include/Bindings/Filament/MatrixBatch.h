@@ -0,0 +1,44 @@
+//
+//  MatrixBatch.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+
+#ifndef MatrixBatch_h
+#define MatrixBatch_h
+
+/**
+ * Operations on arrays of matrices, vectors and quaternions.
+ *
+ * <p>Each element is processed with the CPU's vector unit, and large batches are spread over the
+ * CPU cores. Results may be written over the operands.</p>
+ */
+@interface MatrixBatch : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+- (id) init NS_UNAVAILABLE;
+
+/** Multiplies each matrix of <code>a</code> by the matrix of <code>b</code> at the same index. */
++ (void) multiply: (const simd_float4x4*) a :(const simd_float4x4*) b :(size_t) count :(simd_float4x4*) result;
+/** Multiplies <code>a</code> by each matrix of <code>b</code>, e.g. a parent transform by local transforms. */
++ (void) multiplyAll: (simd_float4x4) a :(const simd_float4x4*) b :(size_t) count :(simd_float4x4*) result;
+/** Transforms each vector by the matrix at the same index. */
++ (void) transform: (const simd_float4x4*) matrices :(const simd_float4*) vectors :(size_t) count :(simd_float4*) result;
+/** Transforms each vector by the same matrix. */
++ (void) transformAll: (simd_float4x4) matrix :(const simd_float4*) vectors :(size_t) count :(simd_float4*) result;
+/** Inverts affine transforms, which is much cheaper than a general inverse. */
++ (void) affineInverse: (const simd_float4x4*) matrices :(size_t) count :(simd_float4x4*) result;
+/** Computes normal matrices, the inverse transposes of the upper 3x3 of the transforms. */
++ (void) normalMatrices: (const simd_float4x4*) matrices :(size_t) count :(simd_float3x3*) result;
+/** Converts unit quaternions to rotation matrices. */
++ (void) rotationMatrices: (const simd_quatf*) rotations :(size_t) count :(simd_float3x3*) result;
+/**
+ * Composes transforms that apply a scale, then a rotation, then a translation, as used by
+ * glTF nodes.
+ */
++ (void) composeTRS: (const simd_float3*) translations :(const simd_quatf*) rotations :(const simd_float3*) scales :(size_t) count :(simd_float4x4*) result;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* MatrixBatch_h */
@@ -0,0 +1,60 @@
+//
+//  ParameterBlock.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "Material.h"
+
+#ifndef ParameterBlock_h
+#define ParameterBlock_h
+
+/**
+ * A set of material parameter values that can be applied to a {@link MaterialInstance} in a
+ * single call.
+ *
+ * <p>Values are keyed by {@link ParameterHandle}, so parameter names are resolved once instead
+ * of being converted on every update. Setting a handle that is already in the block replaces
+ * its value in place; a block can therefore be kept around and updated every frame.</p>
+ *
+ * <p>The setters do not validate the value against the parameter type; as with
+ * MaterialInstance#setParameterFloat, a mismatch is reported by Filament when the block is
+ * applied.</p>
+ *
+ * @see MaterialInstance#setParameters
+ */
+NS_SWIFT_NAME(MaterialInstance.ParameterBlock)
+@interface ParameterBlock : NSObject
+
+- (nonnull id) init;
+
+NS_ASSUME_NONNULL_BEGIN
+- (void) setBool: (ParameterHandle*) handle :(bool) boolean;
+- (void) setFloat: (ParameterHandle*) handle :(float) decimal;
+- (void) setInt: (ParameterHandle*) handle :(int) integer;
+- (void) setBool2: (ParameterHandle*) handle :(bool) boolean1 :(bool) boolean2;
+- (void) setFloat2: (ParameterHandle*) handle :(simd_float2) vector;
+- (void) setInt2: (ParameterHandle*) handle :(simd_int2) vector;
+- (void) setBool3: (ParameterHandle*) handle :(bool) boolean1 :(bool) boolean2 :(bool) boolean3;
+- (void) setFloat3: (ParameterHandle*) handle :(simd_float3) vector;
+- (void) setInt3: (ParameterHandle*) handle :(simd_int3) vector;
+- (void) setBool4: (ParameterHandle*) handle :(bool) boolean1 :(bool) boolean2 :(bool) boolean3 :(bool) boolean4;
+- (void) setFloat4: (ParameterHandle*) handle :(simd_float4) vector;
+- (void) setInt4: (ParameterHandle*) handle :(simd_int4) vector;
+- (void) setMat3f: (ParameterHandle*) handle :(simd_float3x3) matrix;
+- (void) setMat4f: (ParameterHandle*) handle :(simd_float4x4) matrix;
+NS_ASSUME_NONNULL_END
+
+/**
+ * Sets every parameter held by this block on the given instance.
+ *
+ * @param instance An instance of the material the handles were resolved against.
+ */
+- (void) applyTo: (nonnull MaterialInstance*) instance;
+/** Returns the number of parameters held by this block. */
+- (size_t) getCount;
+/** Removes all parameters from this block. */
+- (void) clear;
+
+@end
+
+#endif /* ParameterBlock_h */
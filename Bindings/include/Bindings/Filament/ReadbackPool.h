@@ -0,0 +1,78 @@
+//
+//  ReadbackPool.h
+//
+#import <Foundation/Foundation.h>
+#import "Texture.h"
+
+#ifndef ReadbackPool_h
+#define ReadbackPool_h
+
+@class Renderer;
+@class RenderTarget;
+
+/**
+ * Called once a read-back has completed.
+ *
+ * @param pixels    The read-back pixels. They live in one of the pool's buffers, which is handed
+ *                  back to the pool when <code>pixels</code> is released: copy what must be kept
+ *                  and let go of it promptly.
+ * @param tag       The tag given when the read-back was issued, typically a frame number.
+ */
+typedef void (^ReadbackCompletion)(NSData* _Nonnull pixels, uint64_t tag) NS_SWIFT_NAME(Renderer.ReadbackCompletion);
+
+/**
+ * A ring of preallocated client-side buffers for asynchronous {@link Renderer#readPixels}.
+ *
+ * <p>Each read-back borrows a free buffer, which is filled by the GPU and handed to the
+ * completion block without copying. Buffers return to the ring when the <code>NSData</code>
+ * given to the completion is released, so a steady stream of read-backs neither stalls nor
+ * allocates pixel memory. When every buffer is in flight, new read-backs are refused instead of
+ * waiting.</p>
+ *
+ * <p>Completions are dispatched on <code>queue</code> as soon as the backend reports them, or on
+ * the engine's main thread during {@link Renderer#beginFrame} when no queue is given. The pool
+ * stays alive until all its read-backs have completed and their pixels have been released.</p>
+ */
+NS_SWIFT_NAME(Renderer.ReadbackPool)
+@interface ReadbackPool : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/** Format of the read-back pixels. */
+@property (nonatomic, readonly) Format format;
+/** Type of the read-back pixels. */
+@property (nonatomic, readonly) PixelDataType type;
+/** Size in bytes of each buffer. */
+@property (nonatomic, readonly) NSUInteger bufferSize;
+/** Number of buffers in the ring. */
+@property (nonatomic, readonly) NSUInteger bufferCount;
+
+- (id) init NS_UNAVAILABLE;
+/**
+ * Creates a pool and allocates all its buffers up front.
+ *
+ * @param bufferCount   Number of read-backs that can be in flight or held at once.
+ * @param bufferSize    Size in bytes of each buffer, e.g. <code>width * height * 4</code> for
+ *                      RGBA unsigned bytes.
+ * @param format        Format of the read-back pixels.
+ * @param type          Type of the read-back pixels.
+ * @param queue         Queue completions are dispatched on, or nil for the engine's main thread.
+ */
+- (instancetype) init: (NSUInteger) bufferCount :(NSUInteger) bufferSize :(Format) format :(PixelDataType) type :(nullable dispatch_queue_t) queue;
+
+/** Number of buffers ready for a new read-back. */
+- (NSUInteger) getAvailableCount;
+
+/**
+ * Issues an asynchronous read-back of the renderer's swap chain, or of <code>target</code>.
+ *
+ * <p>Must be called within a frame, like {@link Renderer#readPixels}.</p>
+ *
+ * @return false, without reading back, when no buffer is available or the region does not
+ *         fit in one.
+ */
+- (bool) readPixels: (Renderer*) renderer :(nullable RenderTarget*) target :(int) xoffset :(int) yoffset :(int) width :(int) height :(uint64_t) tag :(ReadbackCompletion) completion;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* ReadbackPool_h */
@@ -170,8 +170,16 @@ typedef NS_ENUM(NSInteger, PrimitiveType) {
 /**
  * Updates the bone transforms in the range [offset, offset + boneCount).
  * The bones must be pre-allocated using Builder::skinning().
+ *
+ * Each bone is given as two consecutive float4 rows: a unit quaternion (x, y, z, w) followed by
+ * a translation (x, y, z, unused), so transforms must hold 2 * boneCount elements.
  */
 - (void) setBones: (EntityInstance) instance :(nonnull const simd_float4*) transforms :(size_t) boneCount :(size_t) offset;
+/**
+ * Updates the bone transforms in the range [offset, offset + boneCount) from 4x4 matrices.
+ * The bones must be pre-allocated using Builder::skinning().
+ */
+- (void) setBoneMatrices: (EntityInstance) instance :(nonnull const simd_float4x4*) transforms :(size_t) boneCount :(size_t) offset;
 /**
  * Associates a region of a SkinningBuffer to a renderable instance
  *
@@ -13,6 +13,7 @@
 #import "Viewport.h"
 #import "Texture.h"
 #import "RenderTarget.h"
+#import "ReadbackPool.h"
 
 #ifndef Renderer_h
 #define Renderer_h
@@ -281,10 +282,14 @@ NS_SWIFT_NAME(Renderer.ClearOptions)
  *                  not supported, this operation may fail silently. Use a DEBUG build
  *                  to get some logs about the failure.</p>
  *
+ * @return          empty data. The read-back completes frames after this method returns, so
+ *                  there are no pixels to return yet: use {@link #readPixelsAsync}, whose
+ *                  completion receives them.
+ *
  * @exception BufferOverflowException if the specified parameters would result in reading
  * outside of <code>buffer</code>.
  */
-- (nonnull NSData*) readPixels: (int) xoffset :(int) yoffset :(int) width :(int) height;
+- (nonnull NSData*) readPixels: (int) xoffset :(int) yoffset :(int) width :(int) height DEPRECATED_MSG_ATTRIBUTE("Use readPixelsAsync with a ReadbackPool");
 /**
  * Reads back the content of a specified {@link RenderTarget}.
  *
@@ -351,10 +356,30 @@ NS_SWIFT_NAME(Renderer.ClearOptions)
  *                  not supported, this operation may fail silently. Use a DEBUG build
  *                  to get some logs about the failure.</p>
  *
+ * @return          empty data. The read-back completes frames after this method returns, so
+ *                  there are no pixels to return yet: use {@link #readPixelsAsync}, whose
+ *                  completion receives them.
+ *
  * @exception BufferOverflowException if the specified parameters would result in reading
  * outside of <code>buffer</code>.
  */
-- (nonnull NSData*) readPixels: (nonnull RenderTarget*) target :(int) xoffset :(int) yoffset :(int) width :(int) height;
+- (nonnull NSData*) readPixels: (nonnull RenderTarget*) target :(int) xoffset :(int) yoffset :(int) width :(int) height DEPRECATED_MSG_ATTRIBUTE("Use readPixelsAsync with a ReadbackPool");
+/**
+ * Issues an asynchronous read-back of the {@link SwapChain} into a buffer of <code>pool</code>.
+ *
+ * <p>Must be called within a frame, like {@link #readPixels}. <code>completion</code> receives
+ * the pixels and <code>tag</code> once the GPU has produced them, typically a few frames later.</p>
+ *
+ * @return false when the pool has no buffer available or the region does not fit in one.
+ * @see ReadbackPool
+ */
+- (bool) readPixelsAsync: (nonnull ReadbackPool*) pool :(int) xoffset :(int) yoffset :(int) width :(int) height :(uint64_t) tag :(nonnull ReadbackCompletion) completion;
+/**
+ * Issues an asynchronous read-back of a {@link RenderTarget} into a buffer of <code>pool</code>.
+ *
+ * @see #readPixelsAsync
+ */
+- (bool) readPixelsAsync: (nonnull ReadbackPool*) pool :(nonnull RenderTarget*) target :(int) xoffset :(int) yoffset :(int) width :(int) height :(uint64_t) tag :(nonnull ReadbackCompletion) completion;
 /**
  * Returns a timestamp (in seconds) for the last call to {@link #beginFrame}. This value is
  * constant for all {@link View views} rendered during a frame. The epoch is set with
@@ -91,6 +91,13 @@
  * @param count Size of the entity array.
  */
 - (void) addEntities: (nonnull NSArray<NSNumber*>*) entities;
+/**
+ * Adds a list of entities to the Scene.
+ *
+ * @param entities Array containing entities to add to the scene.
+ * @param count Size of the entity array.
+ */
+- (void) addEntities: (nonnull const Entity*) entities :(size_t) count;
 /**
  * Removes the Renderable from the Scene.
  *
@@ -108,6 +115,15 @@
  * @param count Size of the entity array.
  */
 - (void) removeEntities: (nonnull NSArray<NSNumber*>*) entities;
+/**
+ * Removes a list of entities to the Scene.
+ *
+ * If any of the specified entities do not exist in the scene, they are skipped.
+ *
+ * @param entities Array containing entities to remove from the scene.
+ * @param count Size of the entity array.
+ */
+- (void) removeEntities: (nonnull const Entity*) entities :(size_t) count;
 /**
  * Returns the number of Renderable objects in the Scene.
  *
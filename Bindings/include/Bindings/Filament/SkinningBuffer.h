@@ -19,7 +19,8 @@
 /**
  * Updates the bone transforms in the range [offset, offset + count).
  * @param engine Reference to the filament::Engine to associate this SkinningBuffer with.
- * @param transforms pointer to at least count Bone
+ * @param transforms pointer to at least count Bone, each given as two float4 rows: a unit
+ *                   quaternion (x, y, z, w) followed by a translation (x, y, z, unused)
  * @param count number of Bone elements in transforms
  * @param offset offset in elements (not bytes) in the SkinningBuffer (not in transforms)
  * @see RenderableManager::setSkinningBuffer
@@ -34,7 +35,7 @@
  * @param offset offset in elements (not bytes) in the SkinningBuffer (not in transforms)
  * @see RenderableManager::setSkinningBuffer
  */
-//- (void) setBones: (nonnull Engine*) engine :(math::mat4f const*) transforms :(size_t) count :(size_t) offset;
+- (void) setBoneMatrices: (nonnull Engine*) engine :(nonnull simd_float4x4 const*) transforms :(size_t) count :(size_t) offset;
 
 /**
  * Returns the size of this SkinningBuffer in elements.
@@ -89,7 +89,6 @@
  */
 @class Engine;
 @class Stream;
-@class PrefilterOptions;
 
 
 typedef NS_ENUM(NSInteger,InternalFormat) {
@@ -229,11 +228,76 @@ typedef NS_ENUM(NSInteger,TextureUsage) {
 
 
 
+/**
+ * Pixel data type
+ */
+typedef NS_ENUM(NSInteger, PixelDataType) {
+    PixelDataTypeUByte,             //!< unsigned byte
+    PixelDataTypeByte,              //!< signed byte
+    PixelDataTypeUShort,            //!< unsigned short (16-bit)
+    PixelDataTypeShort,             //!< signed short (16-bit)
+    PixelDataTypeUInt,              //!< unsigned int (32-bit)
+    PixelDataTypeInt,               //!< signed int (32-bit)
+    PixelDataTypeHalf,              //!< half-float (16-bit float)
+    PixelDataTypeFloat,             //!< float (32-bits float)
+    PixelDataTypeCompressed,        //!< compressed pixels, see PixelBufferDescriptor.compressedFormat
+    PixelDataTypeUInt_10F_11F_11F_REV,  //!< three low precision floating-point numbers
+    PixelDataTypeUShort_565,        //!< unsigned int (16-bit), encodes 3 RGB channels
+    PixelDataTypeUInt_2_10_10_10_REV,   //!< unsigned normalized 10 bits RGB, 2 bits alpha
+};
+
+/**
+ * A description of client-side pixel data to upload into a {@link Texture}.
+ *
+ * <p>The descriptor references the bytes of <code>data</code> without copying them. The data is
+ * retained until the upload has been consumed by the engine and released right after, so memory
+ * borrowed with <code>-[NSData initWithBytesNoCopy:length:deallocator:]</code> gets its
+ * deallocator called as soon as it can be reused. The contents must not be modified before that.</p>
+ *
+ * <p>Descriptors are plain values: the same instance can be reused for any number of uploads,
+ * for instance by moving <code>offset</code> through a large staging buffer.</p>
+ */
 NS_SWIFT_NAME(Texture.PixelBufferDescriptor)
 @interface PixelBufferDescriptor : NSObject
-@property (nonatomic, readonly, nonnull) void* buffer  NS_SWIFT_UNAVAILABLE("Don't access the raw pointers");
-- (nonnull id) init: (nonnull void*) buffer NS_SWIFT_UNAVAILABLE("Instances are created internally");
-- (nonnull id) init NS_UNAVAILABLE;
+NS_ASSUME_NONNULL_BEGIN
+/** Client-side memory holding the pixels. */
+@property (nonatomic, strong) NSData* data;
+/** Offset in bytes of the first pixel in <code>data</code>. */
+@property (nonatomic) NSUInteger offset;
+/** Number of bytes used from <code>offset</code>, or 0 to use the rest of <code>data</code>. */
+@property (nonatomic) NSUInteger length;
+/** Format of the pixels, ignored for compressed data. */
+@property (nonatomic) Format format;
+/** Type of the pixels' components. */
+@property (nonatomic) PixelDataType type;
+/** Format of compressed pixels, only used when <code>type</code> is PixelDataTypeCompressed. */
+@property (nonatomic) InternalFormat compressedFormat;
+/** Row alignment in bytes, 1 by default. */
+@property (nonatomic) uint8_t alignment;
+/** Left coordinate in pixels of the region to use within the rows of <code>data</code>. */
+@property (nonatomic) uint32_t left;
+/** Top coordinate in pixels of the region to use within the rows of <code>data</code>. */
+@property (nonatomic) uint32_t top;
+/** Row length in pixels of <code>data</code>, or 0 when rows are as wide as the uploaded region. */
+@property (nonatomic) uint32_t stride;
+
+- (id) init NS_UNAVAILABLE;
+- (instancetype) initWithData: (NSData*) data :(Format) format :(PixelDataType) type;
+- (instancetype) initWithCompressedData: (NSData*) data :(InternalFormat) compressedFormat;
+NS_ASSUME_NONNULL_END
+@end
+
+/**
+ * Options for environment prefiltering into reflection map
+ *
+ * @see Texture#generatePrefilterMipmap
+ */
+NS_SWIFT_NAME(Texture.PrefilterOptions)
+@interface PrefilterOptions : NSObject
+/** sample count used for filtering, 8 by default */
+@property (nonatomic) uint16_t sampleCount;
+/** whether the environment must be mirrored, true by default */
+@property (nonatomic) bool mirror;
 @end
 
 /**
@@ -283,6 +347,10 @@ NS_SWIFT_NAME(Texture.PixelBufferDescriptor)
  *
  * <code>setImage(engine, level, 0, 0, getWidth(level), getHeight(level), buffer)</code>
  *
+ * <p>The pixels are expected in the natural layout of {@link #getFormat()}, e.g. RGBA
+ * unsigned bytes for {@link InternalFormat#RGBA8}. Use {@link #setImageBuffer} to upload other
+ * layouts or ranges of a larger buffer. Mutable data is copied before the upload.</p>
+ *
  * @param engine    {@link Engine} this texture is associated to. Must be the
  *                  instance passed to {@link Builder#build Builder.build()}.
  * @param level     Level to set the image for. Must be less than {@link #getLevels()}.
@@ -379,6 +447,60 @@ NS_SWIFT_NAME(Texture.PixelBufferDescriptor)
  * @see PixelBufferDescriptor
  */
 - (void) setImage: (nonnull Engine*) engine :(int) level :(nonnull NSData*) buffer :(simd_double2x3) faceOffset;
+/**
+ * Modifies the whole content of a level of the texture from a {@link PixelBufferDescriptor}.
+ *
+ * <p>Unlike the <code>NSData</code> variants, the layout of the pixels is described by
+ * <code>buffer</code> and its bytes are referenced directly: no copy is made.</p>
+ *
+ * @param engine    {@link Engine} this texture is associated to.
+ * @param level     Level to set the image for. Must be less than {@link #getLevels()}.
+ * @param buffer    Description of the client-side pixels to upload.
+ */
+- (void) setImageBuffer: (nonnull Engine*) engine :(int) level :(nonnull PixelBufferDescriptor*) buffer;
+/**
+ * Modifies a sub-region of a level of the texture from a {@link PixelBufferDescriptor},
+ * without copying its bytes.
+ *
+ * <p>Use the descriptor's <code>left</code>, <code>top</code> and <code>stride</code> to upload
+ * a region of a larger client-side image, such as a tile of an atlas.</p>
+ */
+- (void) setImageBuffer: (nonnull Engine*) engine :(int) level :(int) xoffset :(int) yoffset :(int) width :(int) height :(nonnull PixelBufferDescriptor*) buffer;
+/**
+ * Modifies a sub-region of a 3D texture or 2D texture array from a
+ * {@link PixelBufferDescriptor}, without copying its bytes.
+ */
+- (void) setImageBuffer: (nonnull Engine*) engine :(int) level :(int) xoffset :(int) yoffset :(int) zoffset :(int) width :(int) height :(int) depth :(nonnull PixelBufferDescriptor*) buffer;
+/**
+ * Specifies all six images of a cubemap level from a {@link PixelBufferDescriptor}, without
+ * copying its bytes.
+ *
+ * @param faceOffset    Offsets in bytes from the descriptor's <code>offset</code> for all six
+ *                      images, in the following order: +x, -x, +y, -y, +z, -z.
+ */
+- (void) setImageBuffer: (nonnull Engine*) engine :(int) level :(nonnull PixelBufferDescriptor*) buffer :(simd_double2x3) faceOffset;
+/**
+ * Uploads several consecutive mip levels stored in a single client-side buffer.
+ *
+ * <p>Every level references the bytes of <code>buffer</code> directly, and the buffer is released
+ * once the last of them has been consumed. Levels are sized after this texture's dimensions at
+ * each level; the depth of 2D arrays and the six faces of cubemaps are uploaded as well.</p>
+ *
+ * @param engine        {@link Engine} this texture is associated to.
+ * @param baseLevel     First level to upload.
+ * @param buffer        Description of the pixels of all levels. Its <code>offset</code> and
+ *                      <code>length</code> delimit the whole chain.
+ * @param levelOffsets  Offsets in bytes of each level from the descriptor's <code>offset</code>,
+ *                      in increasing order. Each level extends to the start of the next one.
+ *                      When NULL, levels are assumed to be tightly packed, which requires
+ *                      uncompressed data.
+ * @param levelCount    Number of levels to upload, clamped to {@link #getLevels()}.
+ * @return false, without uploading any level, when the data is compressed and
+ *         <code>levelOffsets</code> is NULL, when a level is empty or extends past the
+ *         available bytes of <code>buffer</code>, or when a cubemap level cannot be split in
+ *         six faces of equal size.
+ */
+- (bool) setMipChain: (nonnull Engine*) engine :(int) baseLevel :(nonnull PixelBufferDescriptor*) buffer :(nullable const NSUInteger*) levelOffsets :(NSUInteger) levelCount;
 /**
  * Specifies the external image to associate with this <code>Texture</code>.
  *
@@ -464,9 +586,8 @@ NS_SWIFT_NAME(Texture.PixelBufferDescriptor)
  *
  * @param engine    {@link Engine} this texture is associated to. Must be the
  *                  instance passed to {@link Builder#build Builder.build()}.
- * @param buffer    Client-side buffer containing the image to set.
- *                  <code>buffer</code>'s {@link Format format} and {@link Type type} must match
- *                  the constraints above.
+ * @param buffer    Client-side buffer containing the image to set, as {@link Format#RGB}
+ *                  {@link PixelDataType#Float} pixels.
  * @param faceOffsetsInBytes    Offsets in bytes into <code>buffer</code> for all six images.
  *                              The offsets are specified in the following order:
  *                              +x, -x, +y, -y, +z, -z.
@@ -481,6 +602,14 @@ NS_SWIFT_NAME(Texture.PixelBufferDescriptor)
  * outside of <code>buffer</code>.
  */
 - (void) generatePrefilterMipmap: (nonnull Engine*) engine :(nonnull NSData*) buffer :(simd_double2x3) faceOffset :(nonnull PrefilterOptions*) options;
+/**
+ * Creates a reflection map from an environment map described by a
+ * {@link PixelBufferDescriptor}.
+ *
+ * <p>Same as {@link #generatePrefilterMipmap}, for data that is not {@link PixelDataType#Float}.
+ * The descriptor's bytes are not copied.</p>
+ */
+- (void) generatePrefilterMipmapBuffer: (nonnull Engine*) engine :(nonnull PixelBufferDescriptor*) buffer :(simd_double2x3) faceOffset :(nullable PrefilterOptions*) options;
 
 @end
 
@@ -150,6 +150,34 @@
  * @see #getTransform
  */
 - (void) setTransform: (EntityInstance) instance :(simd_double4x4) localTransform;
+/**
+ * Sets the local transforms of many transform components at once.
+ *
+ * <p>The matrices are handed to Filament at single precision without any per-element
+ * conversion. The updates are wrapped in a local transform transaction, which is committed
+ * before this returns, unless the caller opened one with {@link #openLocalTransformTransaction}:
+ * the updates are then part of it, and the caller still commits it.</p>
+ *
+ * @param instances       <code>count</code> {@link EntityInstance}s of the transform components
+ *                        to update.
+ * @param localTransforms <code>count</code> local transforms (i.e. relative to the parent), in
+ *                        the same order as <code>instances</code>.
+ * @param count           number of transforms to set.
+ * @see #setTransform
+ */
+- (void) setTransforms: (nonnull const EntityInstance*) instances :(nonnull const simd_float4x4*) localTransforms :(size_t) count;
+/**
+ * Sets the local transforms of many transform components at once from their translations,
+ * rotations and scales, composed in a single pass before being set like {@link #setTransforms}.
+ *
+ * @param instances       <code>count</code> {@link EntityInstance}s of the transform components
+ *                        to update.
+ * @param translations    <code>count</code> translations.
+ * @param rotations       <code>count</code> unit quaternions.
+ * @param scales          <code>count</code> scales, applied first.
+ * @param count           number of transforms to set.
+ */
+- (void) setTransformsTRS: (nonnull const EntityInstance*) instances :(nonnull const simd_float3*) translations :(nonnull const simd_quatf*) rotations :(nonnull const simd_float3*) scales :(size_t) count;
 /**
  * Returns the local transform of a transform component.
  *
@@ -0,0 +1,101 @@
+//
+//  TrsStore.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "Entity.h"
+
+#ifndef TrsStore_h
+#define TrsStore_h
+
+@class EntityManager;
+@class TransformManager;
+
+/**
+ * Translations, rotations and scales of entities, turned into local transforms in batches.
+ *
+ * <p>The components are stored as one array per coordinate. Setting a component marks it
+ * dirty, and {@link #flush} composes the transforms of the dirty components eight at a time
+ * with the CPU's vector unit and sets them on the TransformManager in a single transaction, so
+ * animating many entities costs one pass per frame instead of one transform update per
+ * change.</p>
+ *
+ * <p>The entities must have a transform component, whose local transform is overwritten by each
+ * flush that finds them dirty. Instances are invalidated by {@link #destroy}, {@link #gc} and
+ * {@link #collect}, like those of other component managers.</p>
+ *
+ * <p>Components of destroyed entities are garbage. {@link #gc} finds some of them by probing
+ * random components, which can leave garbage behind for many frames after a mass destruction.
+ * A store created with an EntityManager is notified of every destroyed entity instead, and
+ * {@link #collect} removes their components in order, within a time or count budget.</p>
+ */
+NS_SWIFT_NAME(TransformManager.TrsStore)
+@interface TrsStore : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+- (instancetype) init;
+/**
+ * Creates a store that queues the entities destroyed by <code>entityManager</code>, from any
+ * thread, for {@link #collect}.
+ */
+- (instancetype) init: (EntityManager*) entityManager;
+
+/** Returns whether an entity has a component in this store. */
+- (bool) hasComponent: (Entity) entity;
+/** Returns the instance of the component of an entity, or 0 if it has none. */
+- (EntityInstance) getInstance: (Entity) entity;
+/** Number of components in the store. */
+- (size_t) getComponentCount;
+
+/** Creates an identity component for an entity, or returns its existing one. */
+- (EntityInstance) create: (Entity) entity;
+/** Creates a component for an entity, or updates its existing one. */
+- (EntityInstance) create: (Entity) entity :(simd_float3) translation :(simd_quatf) rotation :(simd_float3) scale;
+/** Destroys the component of an entity. */
+- (void) destroy: (Entity) entity;
+/** Destroys some of the components of entities that are no longer alive, found at random. */
+- (void) gc: (EntityManager*) entityManager;
+/**
+ * Destroys the components of the entities destroyed since the store was created, oldest
+ * first, until the queue is empty or a budget is spent. The queue is processed in batches of
+ * 64 entities between checks of the time.
+ *
+ * @param budget    Time in seconds after which no more batch is started, or 0 for no limit.
+ * @param maxCount  Largest number of destroyed entities processed, or 0 for no limit.
+ * @return the number of components destroyed.
+ */
+- (size_t) collect: (NSTimeInterval) budget :(size_t) maxCount;
+/**
+ * Number of destroyed entities waiting for {@link #collect}, an upper bound of the garbage
+ * components since not all of them may have one.
+ */
+- (size_t) getPendingCount;
+/** Number of components destroyed by {@link #collect} so far. */
+- (uint64_t) getCollectedCount;
+
+- (void) setTranslation: (EntityInstance) instance :(simd_float3) translation;
+- (void) setRotation: (EntityInstance) instance :(simd_quatf) rotation;
+- (void) setScale: (EntityInstance) instance :(simd_float3) scale;
+- (void) setTrs: (EntityInstance) instance :(simd_float3) translation :(simd_quatf) rotation :(simd_float3) scale;
+/** Sets the components of many instances at once. */
+- (void) setTrs: (const EntityInstance*) instances :(const simd_float3*) translations :(const simd_quatf*) rotations :(const simd_float3*) scales :(size_t) count;
+
+- (simd_float3) getTranslation: (EntityInstance) instance;
+- (simd_quatf) getRotation: (EntityInstance) instance;
+- (simd_float3) getScale: (EntityInstance) instance;
+/** Returns the transform composed from a component. */
+- (simd_float4x4) getTransform: (EntityInstance) instance;
+
+/** Number of components changed since the last flush. */
+- (size_t) getDirtyCount;
+/**
+ * Sets the local transforms of the entities whose components changed since the last flush.
+ *
+ * @return the number of transforms set.
+ */
+- (size_t) flush: (TransformManager*) manager;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* TrsStore_h */
@@ -32,6 +32,21 @@
  */
 - (void) setBufferAt: (nonnull Engine*) engine :(int) bufferIndex :(nonnull NSData*) data :(int) byteOffset;
 - (void) setBufferAt: (nonnull Engine*) engine :(int) bufferIndex :(nonnull NSData*) data;
+/**
+ * Asynchronously initializes the specified buffer directly from the bytes of the given data.
+ *
+ * Unlike setBufferAt, no intermediate copy is made: the data is retained and released once
+ * Filament has consumed it. The contents must not be mutated until then.
+ *
+ * @param engine Reference to the filament::Engine to associate this VertexBuffer with.
+ * @param bufferIndex Index of the buffer to initialize. Must be between 0
+ *                    and Builder::bufferCount() - 1.
+ * @param data Raw, untyped data that will be uploaded as-is into the buffer.
+ * @param byteOffset Offset in *bytes* into the buffer at index \p bufferIndex of this vertex
+ *                   buffer set.
+ */
+- (void) setBufferAtNoCopy: (nonnull Engine*) engine :(int) bufferIndex :(nonnull NSData*) data :(int) byteOffset;
+- (void) setBufferAtNoCopy: (nonnull Engine*) engine :(int) bufferIndex :(nonnull NSData*) data;
 
 @end
 
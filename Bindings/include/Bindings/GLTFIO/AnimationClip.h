@@ -0,0 +1,83 @@
+//
+//  AnimationClip.h
+//
+#import <Foundation/Foundation.h>
+#import <simd/simd.h>
+#import "FilamentInstance.h"
+
+#ifndef AnimationClip_h
+#define AnimationClip_h
+
+/**
+ * A glTF animation resampled at a fixed rate, for sampling many instances cheaply.
+ *
+ * <p>{@link Animator#applyAnimation} searches the keyframes of every channel and interpolates
+ * nodes one at a time. A clip bakes the poses of the nodes an animation moves at evenly spaced
+ * times instead, stored as one array per component of their translations, rotations and
+ * scales. Sampling it finds the two surrounding poses at once and interpolates all the nodes
+ * eight at a time with the CPU's vector unit, then sets the local transforms of an instance in
+ * a single transaction. Crowds of instances of the same asset are sampled in parallel.</p>
+ *
+ * <p>Baking at a rate around that of the source keyframes keeps the clip faithful to linear
+ * channels; step and cubic spline channels are approximated by linear interpolation between the
+ * baked poses. Morph target weights are not part of a clip and still need the Animator.</p>
+ *
+ * <p>A clip can be applied to any instance of the asset it was baked from.</p>
+ */
+NS_SWIFT_NAME(glTFIO.AnimationClip)
+@interface AnimationClip : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Whether rotations are interpolated with nlerp rather than slerp, which is cheaper and
+ * indistinguishable when the baked poses are close to each other. Defaults to false.
+ */
+@property (nonatomic) bool nlerp;
+
+- (id) init NS_UNAVAILABLE;
+/**
+ * Bakes an animation by applying it to <code>instance</code> at <code>sampleRate</code> times
+ * per second, then restores the local transforms of the instance.
+ *
+ * @param animationIndex    Zero-based index of the animation in the asset.
+ * @param sampleRate        Number of poses baked per second of animation, e.g. 30.
+ * @return nil if there is no such animation.
+ */
+- (nullable instancetype) init: (FilamentInstance*) instance :(int) animationIndex :(double) sampleRate;
+
+/** Duration of the animation in seconds. */
+- (double) getDuration;
+/** Number of baked poses. */
+- (size_t) getPoseCount;
+/** Number of nodes the animation moves. */
+- (size_t) getTargetCount;
+/**
+ * Indices of the nodes the animation moves among the entities of an instance, see
+ * {@link FilamentInstance#getEntities}.
+ */
+- (const uint32_t*) getTargetIndices;
+
+/**
+ * Samples the local transforms of the targets at <code>time</code>, which wraps around the
+ * duration like in {@link Animator#applyAnimation}.
+ *
+ * @param translations  Receives {@link #getTargetCount} translations.
+ * @param rotations     Receives {@link #getTargetCount} unit quaternions.
+ * @param scales        Receives {@link #getTargetCount} scales.
+ */
+- (void) sample: (double) time :(simd_float3*) translations :(simd_quatf*) rotations :(simd_float3*) scales;
+
+/** Sets the local transforms of the targets of <code>instance</code> as sampled at <code>time</code>. */
+- (void) apply: (FilamentInstance*) instance :(double) time;
+/**
+ * Sets the local transforms of the targets of each instance as sampled at its own time, with
+ * all the instances sampled in parallel.
+ *
+ * @param times Time of each instance.
+ */
+- (void) applyAll: (NSArray<FilamentInstance*>*) instances :(const double*) times;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* AnimationClip_h */
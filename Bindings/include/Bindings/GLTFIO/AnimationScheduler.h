@@ -0,0 +1,78 @@
+//
+//  AnimationScheduler.h
+//
+#import <Foundation/Foundation.h>
+#import "AnimationClip.h"
+#import "FilamentInstance.h"
+
+#ifndef AnimationScheduler_h
+#define AnimationScheduler_h
+
+@class Camera;
+
+/**
+ * Decides which animated instances to update each frame, and updates them.
+ *
+ * <p>Updating an instance applies its animation, with its Animator or an {@link AnimationClip},
+ * then updates its bone matrices. Instead of updating every instance every frame, a scheduler:
+ * <ul>
+ * <li>skips instances whose bounds are outside the camera's frustum;</li>
+ * <li>updates instances that are small on screen every few frames only, the interval doubling
+ * each time their size halves below {@link #fullRateSize};</li>
+ * <li>stops updating for the frame once {@link #budget} is spent, starting with the instances
+ * that have waited the longest, so the remaining ones are updated in later frames.</li>
+ * </ul>
+ * The bounds of an instance are its bounding box, enlarged by {@link #boundsScale} to account
+ * for animation, placed by the world transform of its root.</p>
+ *
+ * <p>A scheduler must be used on the thread that owns the engine.</p>
+ */
+NS_SWIFT_NAME(glTFIO.AnimationScheduler)
+@interface AnimationScheduler : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/** CPU time in seconds that updates may take per frame. At least one instance is updated. Defaults to 2ms. */
+@property (nonatomic) NSTimeInterval budget;
+/**
+ * Height of the bounds of an instance, as a fraction of the viewport height, from which it is
+ * updated every frame. Defaults to 0.25.
+ */
+@property (nonatomic) float fullRateSize;
+/** Largest number of frames between updates of a visible instance. Defaults to 8. */
+@property (nonatomic) uint32_t maxInterval;
+/** Scale applied to the half extents of the bounding boxes of instances. Defaults to 1.5. */
+@property (nonatomic) float boundsScale;
+
+- (instancetype) init;
+
+/**
+ * Adds an instance that plays one of its animations with its Animator.
+ *
+ * @param timeOffset    Added to the time of the scheduler to get the time of the animation.
+ */
+- (void) add: (FilamentInstance*) instance :(int) animationIndex :(double) timeOffset;
+/** Adds an instance that plays a clip baked from its asset. */
+- (void) addClip: (FilamentInstance*) instance :(AnimationClip*) clip :(double) timeOffset;
+/** Stops updating an instance. */
+- (void) remove: (FilamentInstance*) instance;
+
+/** Updates the instances due at <code>time</code>, as seen from <code>camera</code>. */
+- (void) update: (Camera*) camera :(double) time;
+
+/** Number of instances in the scheduler. */
+- (size_t) getInstanceCount;
+/** Number of instances updated by the last update. */
+- (size_t) getEvaluatedCount;
+/** Number of instances skipped by the last update because they were outside the frustum. */
+- (size_t) getCulledCount;
+/** Number of visible instances skipped by the last update because of their update interval. */
+- (size_t) getThrottledCount;
+/** Number of instances due but skipped by the last update because the budget was spent. */
+- (size_t) getDeferredCount;
+/** CPU time in seconds taken by the last update. */
+- (NSTimeInterval) getUpdateTime;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* AnimationScheduler_h */
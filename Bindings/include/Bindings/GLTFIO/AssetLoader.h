@@ -9,6 +9,7 @@
 #import "MaterialProvider.h"
 #import "FilamentAsset.h"
 #import "FilamentInstance.h"
+#import "InstancePool.h"
 
 #ifndef AssetLoader_h
 #define AssetLoader_h
@@ -90,6 +91,32 @@ NS_SWIFT_NAME(glTFIO.AssetLoader)
  * @return the primary asset that has ownership over all instances
  */
 - (nullable FilamentAsset*) createInstancedAsset: (nonnull NSArray*) bytes :(nonnull NSMutableArray<FilamentInstance*>*) instances;
+/**
+ * Consumes the contents of a glTF 2.0 file and produces a primary asset with
+ * <code>instanceCount</code> instances, which are appended to <code>instances</code>.
+ *
+ * <p>The bytes are handed to gltfio as they are, without unboxing or copying them first.</p>
+ *
+ * @see #createInstancedAsset
+ */
+- (nullable FilamentAsset*) createInstancedAsset: (nonnull NSData*) bytes :(size_t) instanceCount :(nonnull NSMutableArray<FilamentInstance*>*) instances;
+/**
+ * Same as above, for contents given as a pointer and a length in bytes.
+ */
+- (nullable FilamentAsset*) createInstancedAsset: (nonnull const uint8_t*) bytes :(size_t) length :(size_t) instanceCount :(nonnull NSMutableArray<FilamentInstance*>*) instances;
+/**
+ * Same as above, for a glTF 2.0 file that is memory-mapped for the duration of the call.
+ *
+ * @return the primary asset, or nil if the file cannot be read or parsed
+ */
+- (nullable FilamentAsset*) createInstancedAssetFromFile: (nonnull NSString*) path :(size_t) instanceCount :(nonnull NSMutableArray<FilamentInstance*>*) instances;
+/**
+ * Consumes the contents of a glTF 2.0 file and produces an {@link InstancePool} with
+ * <code>capacity</code> instances allocated up front.
+ *
+ * @see InstancePool
+ */
+- (nullable InstancePool*) createInstancePool: (nonnull NSData*) bytes :(size_t) capacity;
 /**
  * Adds a new instance to an instanced asset.
  *
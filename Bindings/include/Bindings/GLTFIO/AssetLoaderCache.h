@@ -0,0 +1,87 @@
+//
+//  AssetLoaderCache.h
+//
+#import <Foundation/Foundation.h>
+#import "FilamentAsset.h"
+#import "FilamentInstance.h"
+
+#ifndef AssetLoaderCache_h
+#define AssetLoaderCache_h
+
+@class AssetLoader;
+
+/**
+ * Called once for every asset the cache creates, typically to load its resources with a
+ * ResourceLoader before its instances are used.
+ */
+typedef void (^AssetCreated)(FilamentAsset* _Nonnull asset) NS_SWIFT_NAME(glTFIO.AssetCreated);
+
+/**
+ * Caches the whole assets created by one AssetLoader, to share them between the users of
+ * identical content.
+ *
+ * <p>Assets are keyed by the SHA-256 digest and length of their glTF or glb file, so loading the
+ * same file twice through the cache, even from different places, parses it and uploads its
+ * buffers and textures only once: later requests get a new instance of the cached asset, which
+ * shares all its GPU resources. Instances are counted as references to their asset, and are
+ * recycled rather than destroyed when released.</p>
+ *
+ * <p>Only identical files are shared: different files that embed the same textures or buffers
+ * each get their own copy, and assets created by other loaders or caches are not seen.</p>
+ *
+ * <p>Assets with no instance in use stay cached. The least recently used of them are destroyed
+ * as long as the cache holds more than its byte budget. The size of an asset is that of its
+ * source file, a stand-in for the GPU memory it uses, which is not tracked.</p>
+ *
+ * <p>Materials are shared by giving every AssetLoader the same MaterialProvider, which caches
+ * them by their key.</p>
+ *
+ * <p>A cache must be used on the thread that loads assets.</p>
+ */
+NS_SWIFT_NAME(glTFIO.AssetLoaderCache)
+@interface AssetLoaderCache : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Size in bytes of source files the cached assets are kept under, as far as assets in use
+ * allow. Lowering it evicts assets immediately.
+ */
+@property (nonatomic) size_t byteBudget;
+
+- (id) init NS_UNAVAILABLE;
+/**
+ * @param loader    Loader creating and destroying the cached assets.
+ * @param created   Called with every new asset, or nil.
+ */
+- (instancetype) init: (AssetLoader*) loader :(size_t) byteBudget :(nullable AssetCreated) created;
+
+/**
+ * Returns an unused instance of the asset made from <code>bytes</code>, creating the asset on
+ * the first request. The entities of the instance are not added to any scene.
+ *
+ * @return nil if the content cannot be parsed or its asset cannot be instanced anymore.
+ */
+- (nullable FilamentInstance*) acquire: (NSData*) bytes;
+/**
+ * Hands back an instance returned by {@link #acquire}, once its entities have been removed
+ * from the scene. Instances that the cache did not hand out, or that were already handed back,
+ * are ignored.
+ */
+- (void) recycle: (FilamentInstance*) instance;
+
+/** Destroys every asset that has no instance in use. */
+- (void) trim;
+
+/** Number of cached assets, in use or not. */
+- (size_t) getAssetCount;
+/** Size of the source files of the cached assets, in use or not. */
+- (size_t) getByteCount;
+/** Number of requests served by a cached asset. */
+- (uint64_t) getHitCount;
+/** Number of requests that created an asset. */
+- (uint64_t) getMissCount;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* AssetLoaderCache_h */
@@ -0,0 +1,100 @@
+//
+//  DecoderPool.h
+//
+#import <Foundation/Foundation.h>
+#import "../Filament/Engine.h"
+#import "TextureProvider.h"
+#import "ResourceLoader.h"
+
+#ifndef DecoderPool_h
+#define DecoderPool_h
+
+/**
+ * Decodes the textures of glTF assets on a fixed set of worker threads, in priority order, and
+ * bounds the time spent uploading them on the main thread.
+ *
+ * <p>The pool creates texture providers for "image/png" and "image/jpeg" content, which are
+ * registered with each ResourceLoader through {@link ResourceLoader#addTextureProvider}. All the
+ * providers of a pool share its threads, so loading many assets at once does not oversubscribe
+ * the CPU. Textures are decoded by decreasing provider priority, color textures (those flagged as
+ * sRGB, such as base color and emissive maps) before data textures (normal, occlusion and
+ * metallic-roughness maps), and otherwise in the order they were pushed.</p>
+ *
+ * <p>Decoded images are uploaded, and their mipmaps generated, by
+ * {@link ResourceLoader#asyncUpdateLoad} or {@link #update}, until {@link #uploadBudget} is
+ * exhausted. The remaining images are uploaded by the following calls.</p>
+ *
+ * <p>Decoded images can be recorded into a snapshot file, which later launches map to upload the
+ * same images without decoding them. Images are matched by the contents of their source, so a
+ * snapshot stays valid for unchanged textures when assets are edited. A snapshot only caches
+ * decoded RGBA textures: it holds no entities, transforms, geometry, materials or compressed
+ * textures, which are still loaded from the assets themselves.</p>
+ *
+ * <p>Like other texture providers, those of a pool are never destroyed. They keep the pool's
+ * worker threads running.</p>
+ */
+NS_SWIFT_NAME(glTFIO.DecoderPool)
+@interface DecoderPool : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/** Number of worker threads. */
+@property (nonatomic, readonly) NSUInteger threadCount;
+/**
+ * Time in seconds that a single update may spend uploading decoded images, or 0 for no limit.
+ * At least one image is uploaded per update, so loading always progresses. Defaults to 4ms.
+ */
+@property (nonatomic) NSTimeInterval uploadBudget;
+
+- (id) init NS_UNAVAILABLE;
+/**
+ * Starts a pool.
+ *
+ * @param threadCount   Number of worker threads, or 0 for one per core minus one, the main
+ *                      thread being busy rendering.
+ */
+- (instancetype) init: (NSUInteger) threadCount;
+
+/** Creates a provider whose textures have the default priority, 0. */
+- (TextureProvider*) createTextureProvider: (Engine*) engine;
+/**
+ * Creates a provider for "image/png" and "image/jpeg" content.
+ *
+ * @param priority  Priority of the provider's textures over those of other providers. Use a
+ *                  provider per asset to prioritise, for instance, the assets closest to the
+ *                  camera or covering most of the screen.
+ */
+- (TextureProvider*) createTextureProvider: (Engine*) engine :(int) priority;
+
+/**
+ * Updates the asynchronous loads of all the given loaders, within a single upload budget.
+ *
+ * @return the progress of the least advanced loader, between 0 and 1.
+ */
+- (double) update: (NSArray<ResourceLoader*>*) loaders;
+
+/** Number of textures waiting for a worker thread. */
+- (NSUInteger) getQueuedCount;
+
+/**
+ * Whether decoded images are kept to be written by {@link #writeSnapshot}, including those found
+ * in a loaded snapshot. Defaults to false.
+ */
+@property (nonatomic) bool recording;
+/**
+ * Maps a snapshot written by {@link #writeSnapshot}, whose images are then uploaded in place of
+ * decoding matching sources. Replaces any snapshot loaded before.
+ *
+ * @return false if the file cannot be read or is not a snapshot.
+ */
+- (bool) loadSnapshot: (NSString*) path;
+/**
+ * Writes the images recorded so far to a snapshot file.
+ *
+ * @return false if the file cannot be written.
+ */
+- (bool) writeSnapshot: (NSString*) path;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* DecoderPool_h */
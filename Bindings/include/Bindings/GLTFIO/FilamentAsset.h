@@ -55,6 +55,36 @@ NS_SWIFT_NAME(glTFIO.FilamentAsset)
  * @see com.google.android.filament.Camera#setScaling
  */
 - (nonnull NSArray<NSNumber*>*) getCameraEntities;
+/**
+ * Gets a pointer to the asset's entities, one for each glTF node, without copying or boxing them.
+ *
+ * The returned storage is owned by the asset and stays valid for its lifetime.
+ * NULL when there are none. See getEntityCount for the number of entities.
+ */
+- (nullable const Entity*) getEntitiesData;
+/** Gets the number of entities returned by getEntities. */
+- (size_t) getEntityCount;
+/**
+ * Gets a pointer to the asset's light entities, without copying or boxing them.
+ * NULL when there are none. See getLightEntityCount for the number of entities.
+ */
+- (nullable const Entity*) getLightEntitiesData;
+/** Gets the number of entities returned by getLightEntities. */
+- (size_t) getLightEntityCount;
+/**
+ * Gets a pointer to the asset's renderable entities, without copying or boxing them.
+ * NULL when there are none. See getRenderableEntityCount for the number of entities.
+ */
+- (nullable const Entity*) getRenderableEntitiesData;
+/** Gets the number of entities returned by getRenderableEntities. */
+- (size_t) getRenderableEntityCount;
+/**
+ * Gets a pointer to the asset's camera entities, without copying or boxing them.
+ * NULL when there are none. See getCameraEntityCount for the number of entities.
+ */
+- (nullable const Entity*) getCameraEntitiesData;
+/** Gets the number of entities returned by getCameraEntities. */
+- (size_t) getCameraEntityCount;
 /**
 * Gets the transform root for the asset, which has no matching glTF node.
 *
@@ -82,6 +112,13 @@ NS_SWIFT_NAME(glTFIO.FilamentAsset)
  * is null, returns the number of available renderables.
  */
 - (size_t) popRenderables: (nullable NSMutableArray<NSNumber *>*) entities;
+/**
+ * Pops up to count renderables off the queue into a caller-owned buffer.
+ *
+ * Returns the number of entities written into the given buffer. If the given buffer
+ * is null, returns the number of available renderables.
+ */
+- (size_t) popRenderables: (nullable Entity*) entities :(size_t) count;
 /** Gets resource URIs for all externally-referenced buffers. */
 - (nonnull NSArray<NSString*>*) getResourceUris;
 /**
@@ -91,6 +128,17 @@ NS_SWIFT_NAME(glTFIO.FilamentAsset)
  * AAAB that can be determined at load time from the asset data.
  */
 - (nonnull Aabb*) getBoundingBox;
+/**
+ * Computes the world-space bounding boxes of the renderables of the asset and all its instances
+ * from their current bounding boxes and world transforms, all at once.
+ *
+ * @param renderables   Receives the renderable entity of each box, or nil.
+ * @param boxes         Receives at most <code>capacity</code> boxes.
+ * @return the number of boxes written.
+ */
+- (size_t) getWorldBoundingBoxes: (nullable Entity*) renderables :(nonnull Box*) boxes :(size_t) capacity;
+/** Returns the world-space bounding box of all the renderables of the asset and its instances. */
+- (Box) getWorldBoundingBox;
 
 /** Gets the NameComponentManager label for the given entity, if it exists. */
 - (nonnull NSString*) getName: (Entity) entity;
@@ -115,6 +163,28 @@ NS_SWIFT_NAME(glTFIO.FilamentAsset)
  * @return array containing the entities
  */
 - (nonnull NSArray<NSNumber*>*) getEntitiesByPrefix: (nonnull NSString*) prefix :(size_t) maxCount;
+/**
+ * Gets entities with the given name into a caller-owned buffer.
+ *
+ * @param name Null-terminated string to match.
+ * @param entities Buffer receiving the entities, or null to only count them.
+ * @param maxCount Maximum number of entities to retrieve.
+ *
+ * @return If entities is non-null, the number of entities written; otherwise the number of
+ *         matching entities.
+ */
+- (size_t) getEntitiesByName: (nonnull NSString*) name :(nullable Entity*) entities :(size_t) maxCount;
+/**
+ * Gets entities whose names start with the given prefix into a caller-owned buffer.
+ *
+ * @param prefix Null-terminated prefix string to match.
+ * @param entities Buffer receiving the entities, or null to only count them.
+ * @param maxCount Maximum number of entities to retrieve.
+ *
+ * @return If entities is non-null, the number of entities written; otherwise the number of
+ *         matching entities.
+ */
+- (size_t) getEntitiesByPrefix: (nonnull NSString*) prefix :(nullable Entity*) entities :(size_t) maxCount;
 /** Gets the glTF extras string for a specific node, or for the asset, if it exists. */
 - (nullable NSString*) getExtras: (Entity) entity;
 /**
@@ -172,6 +242,7 @@ NS_SWIFT_NAME(glTFIO.FilamentAsset)
 * and provides filtering functionality.
 */
 - (void) addEntitiesToScene: (nonnull Scene*) targetScene :(nonnull NSArray<NSNumber*>*) entities :(uint32_t) sceneFilter;
+- (void) addEntitiesToScene: (nonnull Scene*) targetScene :(nonnull const Entity*) entities :(size_t) count :(uint32_t) sceneFilter;
 
 /**
 * Releases ownership of entities and their Filament components.
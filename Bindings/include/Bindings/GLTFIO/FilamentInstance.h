@@ -6,6 +6,7 @@
 #import <Foundation/Foundation.h>
 #import "../Filament/Entity.h"
 #import "../Filament/MaterialInstance.h"
+#import "../Filament/Box.h"
 #import <simd/simd.h>
 
 
@@ -33,6 +34,15 @@ NS_SWIFT_NAME(glTFIO.FilamentInstance)
  */
 - (nonnull NSArray<NSNumber*>*) getEntities;
 + (nonnull NSArray<NSNumber*>*) getEntitiesArray: (nonnull const void*) array :(unsigned long)count;
+/**
+ * Gets a pointer to the instance's entities without copying or boxing them.
+ *
+ * The returned storage is owned by the asset and stays valid for its lifetime.
+ * NULL when there are none. See getEntityCount for the number of entities.
+ */
+- (nullable const Entity*) getEntitiesData;
+/** Gets the number of entities returned by getEntities. */
+- (size_t) getEntityCount;
 /** Gets the transform root for the instance, which has no matching glTF node. */
 - (Entity) getRoot;
 /**
@@ -77,6 +87,18 @@ NS_SWIFT_NAME(glTFIO.FilamentInstance)
  */
 - (nonnull NSArray<NSNumber*>*) getJointsAt: (size_t) skinIndex;
 
+/**
+ * Gets a pointer to the joints at skin index without copying or boxing them.
+ *
+ * NULL when there are none. See getJointCountAt for the number of joints.
+ */
+- (nullable const Entity*) getJointsDataAt: (size_t) skinIndex;
+
+/**
+ * Gets the number of joints at skin index.
+ */
+- (size_t) getJointCountAt: (size_t) skinIndex;
+
 /**
  * Attaches the given skin to the given node, which must have an associated mesh with
  * BONE_INDICES and BONE_WEIGHTS attributes.
@@ -117,6 +139,18 @@ NS_SWIFT_NAME(glTFIO.FilamentInstance)
  */
 //- (Aabb) getBoundingBox;
 
+/**
+ * Computes the world-space bounding boxes of the instance's renderables from their current
+ * bounding boxes and world transforms, all at once.
+ *
+ * @param renderables   Receives the renderable entity of each box, or nil.
+ * @param boxes         Receives at most <code>capacity</code> boxes.
+ * @return the number of boxes written.
+ */
+- (size_t) getWorldBoundingBoxes: (nullable Entity*) renderables :(nonnull Box*) boxes :(size_t) capacity;
+/** Returns the world-space bounding box of all the instance's renderables. */
+- (Box) getWorldBoundingBox;
+
 /** Gets all material instances. These are already bound to renderables. */
 - (nonnull NSArray<MaterialInstance*>*) getMaterialInstances;
 
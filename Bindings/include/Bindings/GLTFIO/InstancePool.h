@@ -0,0 +1,57 @@
+//
+//  InstancePool.h
+//
+#import <Foundation/Foundation.h>
+#import "FilamentAsset.h"
+#import "FilamentInstance.h"
+
+#ifndef InstancePool_h
+#define InstancePool_h
+
+@class AssetLoader;
+
+/**
+ * A set of instances of one glTF asset, allocated up front and handed out on demand.
+ *
+ * <p>Creating the instances together with the asset is much cheaper than adding them one by one,
+ * and recycling them avoids gltfio's create/destroy churn altogether: an acquired instance is
+ * typically added to a scene, and removed from it before being recycled. When every instance is
+ * in use the pool grows by adding a new instance to the asset, which does not reparse it. Growing
+ * is no longer possible once the asset's source data has been released.</p>
+ *
+ * <p>The instances are owned by the asset; destroy it with {@link AssetLoader#destroyAsset}.</p>
+ *
+ * @see AssetLoader#createInstancePool
+ */
+NS_SWIFT_NAME(glTFIO.InstancePool)
+@interface InstancePool : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+/** The primary asset that owns every instance of the pool. */
+@property (nonatomic, readonly) FilamentAsset* asset;
+
+- (id) init NS_UNAVAILABLE;
+- (instancetype) init: (AssetLoader*) loader :(FilamentAsset*) asset :(void* _Nonnull const* _Nonnull) instances :(size_t) count NS_SWIFT_UNAVAILABLE("Instances are created internally");
+
+/**
+ * Returns an instance that is not in use, adding one to the asset if needed.
+ *
+ * @return nil if the pool is exhausted and cannot grow.
+ */
+- (nullable FilamentInstance*) acquire;
+/**
+ * Makes an instance returned by {@link #acquire} available again.
+ *
+ * @return false, leaving the pool unchanged, if the instance belongs to another asset or is
+ *         already available.
+ */
+- (bool) recycle: (FilamentInstance*) instance;
+/** Number of instances ready to be acquired. */
+- (size_t) getAvailableCount;
+/** Number of instances owned by the pool, in use or not. */
+- (size_t) getInstanceCount;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* InstancePool_h */
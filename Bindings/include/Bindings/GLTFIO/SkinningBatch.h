@@ -0,0 +1,68 @@
+//
+//  SkinningBatch.h
+//
+#import <Foundation/Foundation.h>
+#import "FilamentInstance.h"
+#import "Bindings/Filament/Entity.h"
+
+#ifndef SkinningBatch_h
+#define SkinningBatch_h
+
+@class Engine;
+@class SkinningBuffer;
+
+/**
+ * Updates the bone matrices of the skins of many instances at once.
+ *
+ * <p>{@link Animator#updateBoneMatrices} computes the bones of one instance on the calling
+ * thread. A batch computes those of all its skins in parallel across the CPU cores, from the
+ * world transforms of their joints, then uploads them. Bones kept in a {@link SkinningBuffer}
+ * are uploaded with one call per contiguous range of the buffer, so skins laid out back to back
+ * in a shared buffer take a single upload.</p>
+ *
+ * <p>A batch must be used on the thread that owns the engine, after the transforms of the
+ * frame have been set.</p>
+ */
+NS_SWIFT_NAME(glTFIO.SkinningBatch)
+@interface SkinningBatch : NSObject
+NS_ASSUME_NONNULL_BEGIN
+
+- (instancetype) init;
+
+/**
+ * Adds the skin of an instance whose bones are set on a renderable, like the Animator does,
+ * which suits the renderables created by the AssetLoader.
+ *
+ * @param skinIndex Index of the skin in the instance.
+ * @param target    Skinned renderable, whose world transform the bones are relative to.
+ * @return the number of bones of the skin.
+ */
+- (size_t) addSkin: (FilamentInstance*) instance :(size_t) skinIndex :(Entity) target;
+/**
+ * Adds the skin of an instance whose bones are stored in a region of a skinning buffer,
+ * starting at <code>offset</code>, for renderables built with skinning buffers.
+ *
+ * @param skinIndex Index of the skin in the instance.
+ * @param target    Skinned renderable, whose world transform the bones are relative to.
+ * @return the number of bones of the skin.
+ */
+- (size_t) addSkin: (FilamentInstance*) instance :(size_t) skinIndex :(Entity) target :(SkinningBuffer*) buffer :(size_t) offset;
+/** Removes every skin of an instance, e.g. before it is destroyed. */
+- (void) removeInstance: (FilamentInstance*) instance;
+/** Removes every skin. */
+- (void) clear;
+
+/** Computes the bones of every skin and uploads them. */
+- (void) update: (Engine*) engine;
+
+/** Number of skins in the batch. */
+- (size_t) getSkinCount;
+/** Number of bones of all the skins in the batch. */
+- (size_t) getBoneCount;
+/** Number of uploads made by the last update. */
+- (size_t) getUploadCount;
+
+NS_ASSUME_NONNULL_END
+@end
+
+#endif /* SkinningBatch_h */
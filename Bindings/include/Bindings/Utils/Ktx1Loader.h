@@ -13,16 +13,30 @@
 
 NS_ASSUME_NONNULL_BEGIN
 /**
- * Creates a Texture object from a KTX bundle, populates all of its faces and miplevels,
- * and automatically destroys the bundle after all the texture data has been uploaded.
+ * Maps a KTX file into memory.
+ *
+ * Textures created from the returned data are uploaded straight from the mapped pages, and the
+ * mapping is released once the engine has consumed them, so a file is never held in memory
+ * twice.
+ *
+ * @param path Path of the KTX file
+ * @return The mapped contents of the file, or nil if it cannot be read
+ */
++ (nullable NSData*) mapFile: (NSString*) path;
+/**
+ * Creates a Texture object from a KTX bundle and populates all of its faces and miplevels.
+ *
+ * The images are not copied: <code>buffer</code> is retained until all the texture data has
+ * been uploaded.
  *
  * @param engine Used to create the Filament Texture
- * @param ktx In-memory representation of a KTX file
+ * @param ktx In-memory representation of a KTX file, see {@link #mapFile}
  * @param srgb Requests an sRGB format from the KTX file
+ * @return The texture, or nil if <code>buffer</code> is not a valid KTX file
  */
-+ (Texture*) createTexture: (Engine*) engine :(NSData*) buffer :(bool) srgb;
-+ (IndirectLight*) createIndirectLight: (Engine*) engine :(NSData*) buffer :(bool) srgb;
-+ (Skybox*) createSkybox: (Engine*) engine :(NSData*) buffer :(bool) srgb;
++ (nullable Texture*) createTexture: (Engine*) engine :(NSData*) buffer :(bool) srgb;
++ (nullable IndirectLight*) createIndirectLight: (Engine*) engine :(NSData*) buffer :(bool) srgb;
++ (nullable Skybox*) createSkybox: (Engine*) engine :(NSData*) buffer :(bool) srgb;
 + (simd_double3x3) getSphericalHarmonics:(NSData*) buffer;
 
 NS_ASSUME_NONNULL_END
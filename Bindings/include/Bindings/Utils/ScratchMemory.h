@@ -0,0 +1,36 @@
+//
+//  ScratchMemory.h
+//
+#import <Foundation/Foundation.h>
+
+#ifndef ScratchMemory_h
+#define ScratchMemory_h
+
+/**
+ * Statistics of the scratch memory of the calling thread.
+ *
+ * <p>The bindings build their temporary arrays, such as unboxed entities or converted
+ * transforms, in a fixed area of memory per thread that is reused across calls, and only spill
+ * to the heap when an operation needs more than the area holds. Heap spills show that a thread
+ * works on arrays too large for the area.</p>
+ */
+@interface ScratchMemory : NSObject
+
+- (nonnull id) init NS_UNAVAILABLE;
+
+/** Size in bytes of the area of each thread. */
++ (size_t) getAreaSize;
+/** Most bytes of the area in use at once. */
++ (size_t) getHighWaterMark;
+/** Number of allocations that did not fit in the area and were made on the heap. */
++ (size_t) getHeapAllocationCount;
+/** Number of bytes allocated on the heap. */
++ (size_t) getHeapByteCount;
+/** Number of allocations refused because they did not fit in the area and could not spill. */
++ (size_t) getRefusedCount;
+/** Resets the statistics of the calling thread. */
++ (void) resetStatistics;
+
+@end
+
+#endif /* ScratchMemory_h */
@@ -0,0 +1,33 @@
+//
+//  WrapperCache.h
+//
+#import <Foundation/Foundation.h>
+
+#ifndef WrapperCache_h
+#define WrapperCache_h
+
+/**
+ * Statistics of the table interning the wrappers around native handles.
+ *
+ * <p>Getters such as {@link View#getScene} or {@link RenderableManager#getMaterialInstanceAt}
+ * return the same wrapper for the same native object instead of allocating a new one on every
+ * call. Wrappers are dropped from the table when their object is destroyed through the bindings
+ * (for instance {@link Engine#destroyView} or {@link AssetLoader#destroyAsset}), and the table
+ * only references them weakly, so wrappers nobody uses anymore are never kept alive.</p>
+ */
+@interface WrapperCache : NSObject
+
+- (nonnull id) init NS_UNAVAILABLE;
+
+/** Number of lookups that returned an existing wrapper. */
++ (uint64_t) getHitCount;
+/** Number of lookups that had to create a wrapper. */
++ (uint64_t) getMissCount;
+/** Number of live wrappers currently interned. */
++ (size_t) getSize;
+/** Resets the hit and miss counters. */
++ (void) resetCounters;
+
+@end
+
+#endif /* WrapperCache_h */
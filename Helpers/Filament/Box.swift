@@ -80,10 +80,10 @@ extension Box{
      * @return the bounding box of the transformed box
      */
     static func transform(m: simd_float3x3, t: simd_float3, box: Box) -> Box {
-        var box = Box();
-        box.center =  m * box.center + t
-        box.halfExtent = simd_float3x3(columns: (simd_abs(m.columns.0), simd_abs(m.columns.1), simd_abs(m.columns.2))) * box.halfExtent
-        return box
+        var result = Box();
+        result.center =  m * box.center + t
+        result.halfExtent = simd_float3x3(columns: (simd_abs(m.columns.0), simd_abs(m.columns.1), simd_abs(m.columns.2))) * box.halfExtent
+        return result
     }
 }
 extension Aabb{
@@ -7,15 +7,19 @@ import Bindings
 
 extension Scene{
 #warning("interact with entities as an array scene.entities.add")
+    public func addEntities(_ entities: UnsafeBufferPointer<Entity>){
+        guard let base = entities.baseAddress else { return }
+        addEntities(base, entities.count)
+    }
     public func addEntities(_ entities: [Entity]){
-        for entity in entities{
-            addEntity(entity)
-        }
+        entities.withUnsafeBufferPointer{ addEntities($0) }
+    }
+    public func removeEntities(_ entities: UnsafeBufferPointer<Entity>){
+        guard let base = entities.baseAddress else { return }
+        removeEntities(base, entities.count)
     }
     public func removeEntities(_ entities: [Entity]){
-        for entity in entities{
-            remove(entity)
-        }
+        entities.withUnsafeBufferPointer{ removeEntities($0) }
     }
     public var skybox: Skybox?{
         get{
@@ -6,5 +6,24 @@
 import Bindings
 
 extension Texture{
-    
+    @discardableResult
+    public func setMipChain(_ engine: Engine, _ baseLevel: Int32, _ buffer: PixelBufferDescriptor, _ levelOffsets: [UInt]) -> Bool{
+        levelOffsets.withUnsafeBufferPointer{
+            setMipChain(engine, baseLevel, buffer, $0.baseAddress, UInt($0.count))
+        }
+    }
+}
+
+extension Texture.PixelBufferDescriptor{
+    /// Describes pixels owned by the caller without copying them.
+    /// `release` is called once the engine no longer reads from `bytes`.
+    public convenience init(borrowing bytes: UnsafeRawBufferPointer, _ format: Format, _ type: PixelDataType, release: @escaping () -> Void){
+        guard let base = bytes.baseAddress else {
+            release()
+            self.init(data: Data(), format, type)
+            return
+        }
+        let data = NSData(bytesNoCopy: UnsafeMutableRawPointer(mutating: base), length: bytes.count){ _, _ in release() }
+        self.init(data: data as Data, format, type)
+    }
 }
@@ -9,6 +9,15 @@ extension TransformManager{
     public func setTransform(_ instance: EntityInstance, _ localTransform: simd_float4x4){
         setTransform(instance, localTransform.toDouble())
     }
+    public func setTransforms(_ instances: [EntityInstance], _ localTransforms: [simd_float4x4]){
+        precondition(instances.count == localTransforms.count)
+        instances.withUnsafeBufferPointer{ instances in
+            localTransforms.withUnsafeBufferPointer{ transforms in
+                guard let instancesBase = instances.baseAddress, let transformsBase = transforms.baseAddress else { return }
+                setTransforms(instancesBase, transformsBase, instances.count)
+            }
+        }
+    }
     public var accurateTranslations: Bool{
         get{
             isAccurateTranslationsEnabled()
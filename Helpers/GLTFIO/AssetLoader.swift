@@ -6,5 +6,10 @@
 import Bindings
 
 extension glTFIO.AssetLoader{
-    
+    public func createInstancedAsset(_ bytes: UnsafeRawBufferPointer, _ instanceCount: Int) -> (glTFIO.FilamentAsset, [glTFIO.FilamentInstance])?{
+        guard let base = bytes.baseAddress else { return nil }
+        let instances = NSMutableArray()
+        guard let asset = createInstancedAsset(base.assumingMemoryBound(to: UInt8.self), bytes.count, instanceCount, instances) else { return nil }
+        return (asset, instances.compactMap{ $0 as? glTFIO.FilamentInstance })
+    }
 }
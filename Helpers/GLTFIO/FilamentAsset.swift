@@ -7,7 +7,37 @@ import Bindings
 
 extension glTFIO.FilamentAsset{
     public var entities: [Entity]{
-        let ents = getEntities();
-        return ents.map({$0.int32Value})
+        withEntities{ Array($0) }
+    }
+    public var lightEntities: [Entity]{
+        withLightEntities{ Array($0) }
+    }
+    public var renderableEntities: [Entity]{
+        withRenderableEntities{ Array($0) }
+    }
+    public var cameraEntities: [Entity]{
+        withCameraEntities{ Array($0) }
+    }
+    /// Calls `body` with the asset's entities, without copying them.
+    /// The buffer must not escape `body`: it points into storage owned by the asset.
+    public func withEntities<Result>(_ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getEntitiesData(), count: getEntityCount()))
+        }
+    }
+    public func withLightEntities<Result>(_ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getLightEntitiesData(), count: getLightEntityCount()))
+        }
+    }
+    public func withRenderableEntities<Result>(_ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getRenderableEntitiesData(), count: getRenderableEntityCount()))
+        }
+    }
+    public func withCameraEntities<Result>(_ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getCameraEntitiesData(), count: getCameraEntityCount()))
+        }
     }
 }
@@ -6,5 +6,22 @@
 import Bindings
 
 extension glTFIO.FilamentInstance{
-    
+    public var entities: [Entity]{
+        withEntities{ Array($0) }
+    }
+    public func joints(at skinIndex: Int) -> [Entity]{
+        withJoints(at: skinIndex){ Array($0) }
+    }
+    /// Calls `body` with the instance's entities, without copying them.
+    /// The buffer must not escape `body`: it points into storage owned by the asset.
+    public func withEntities<Result>(_ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getEntitiesData(), count: getEntityCount()))
+        }
+    }
+    public func withJoints<Result>(at skinIndex: Int, _ body: (UnsafeBufferPointer<Entity>) throws -> Result) rethrows -> Result{
+        try withExtendedLifetime(self){
+            try body(UnsafeBufferPointer(start: getJointsData(at: skinIndex), count: getJointCount(at: skinIndex)))
+        }
+    }
 }
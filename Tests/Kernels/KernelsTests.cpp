@@ -0,0 +1,532 @@
+//
+//  KernelsTests.cpp
+//
+//  Golden-value tests of the matrix, quaternion and half float kernels of Bindings/Kernels.h.
+//  Each kernel is checked against hand-computed results and against double precision
+//  references over many inputs, through both its eight-lane and its scalar paths.
+//
+
+#include "Kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <stdint.h>
+
+using namespace bindings;
+
+namespace {
+
+int failureCount = 0;
+
+bool check(bool passed, const char* expression, const char* file, int line) {
+    if (!passed) {
+        std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, expression);
+        failureCount++;
+    }
+    return passed;
+}
+
+#define CHECK(expression) check((expression), #expression, __FILE__, __LINE__)
+
+bool near(float a, float b, float tolerance) {
+    return std::abs(a - b) <= tolerance;
+}
+
+bool near(simd_float3 a, simd_float3 b, float tolerance) {
+    return near(a.x, b.x, tolerance) && near(a.y, b.y, tolerance) && near(a.z, b.z, tolerance);
+}
+
+bool near(simd_float4 a, simd_float4 b, float tolerance) {
+    return near(a.x, b.x, tolerance) && near(a.y, b.y, tolerance) && near(a.z, b.z, tolerance)
+            && near(a.w, b.w, tolerance);
+}
+
+bool near(simd_float3x3 const& a, simd_float3x3 const& b, float tolerance) {
+    return near(a.columns[0], b.columns[0], tolerance) && near(a.columns[1], b.columns[1], tolerance)
+            && near(a.columns[2], b.columns[2], tolerance);
+}
+
+bool near(simd_float4x4 const& a, simd_float4x4 const& b, float tolerance) {
+    return near(a.columns[0], b.columns[0], tolerance) && near(a.columns[1], b.columns[1], tolerance)
+            && near(a.columns[2], b.columns[2], tolerance) && near(a.columns[3], b.columns[3], tolerance);
+}
+
+bool near(simd_quatf a, simd_quatf b, float tolerance) {
+    return near(a.vector, b.vector, tolerance);
+}
+
+simd_float4x4 identity4x4() {
+    return simd_matrix(simd_make_float4(1, 0, 0, 0), simd_make_float4(0, 1, 0, 0),
+            simd_make_float4(0, 0, 1, 0), simd_make_float4(0, 0, 0, 1));
+}
+
+simd_float3x3 identity3x3() {
+    return simd_matrix(simd_make_float3(1, 0, 0), simd_make_float3(0, 1, 0), simd_make_float3(0, 0, 1));
+}
+
+float const PI = 3.14159265358979324f;
+float const SQRT1_2 = 0.707106781186547524f;
+
+// 90 degrees around z, and 120 degrees around (1, 1, 1), which cycles the axes
+simd_quatf const QUARTER_TURN_Z = simd_quaternion(0, 0, SQRT1_2, SQRT1_2);
+simd_quatf const AXIS_CYCLE = simd_quaternion(0.5f, 0.5f, 0.5f, 0.5f);
+
+simd_float3 const TRANSLATION = simd_make_float3(1, 2, 3);
+simd_float3 const SCALE = simd_make_float3(2, 4, 8);
+
+// translation (1, 2, 3) * rotation QUARTER_TURN_Z * scale (2, 4, 8)
+simd_float4x4 const TRS = simd_matrix(simd_make_float4(0, 2, 0, 0), simd_make_float4(-4, 0, 0, 0),
+        simd_make_float4(0, 0, 8, 0), simd_make_float4(1, 2, 3, 1));
+
+std::mt19937 generator(0x5eed);
+
+float uniform(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(generator);
+}
+
+simd_float4 randomUnitVector4() {
+    simd_float4 v;
+    do {
+        v = simd_make_float4(uniform(-1, 1), uniform(-1, 1), uniform(-1, 1), uniform(-1, 1));
+    } while (simd_dot(v, v) < 0.01f || simd_dot(v, v) > 1);
+    return simd_normalize(v);
+}
+
+simd_float3 randomScale() {
+    float const sign = uniform(0, 1) < 0.25f ? -1.0f : 1.0f;
+    return simd_make_float3(uniform(0.25f, 4) * sign, uniform(0.25f, 4), uniform(0.25f, 4));
+}
+
+simd_float3 randomTranslation() {
+    return simd_make_float3(uniform(-10, 10), uniform(-10, 10), uniform(-10, 10));
+}
+
+void testComposeTRS() {
+    CHECK(near(composeTRS(TRANSLATION, QUARTER_TURN_Z, SCALE), TRS, 1e-6f));
+    simd_float4x4 const cycle = composeTRS(simd_make_float3(0, 0, 0), AXIS_CYCLE, simd_make_float3(1, 1, 1));
+    CHECK(near(cycle, simd_matrix(simd_make_float4(0, 1, 0, 0), simd_make_float4(0, 0, 1, 0),
+            simd_make_float4(1, 0, 0, 0), simd_make_float4(0, 0, 0, 1)), 1e-6f));
+
+    // the batch, and poses through both their eight-lane and scalar paths
+    size_t const count = 11;
+    std::vector<simd_float3> t(count), s(count);
+    std::vector<simd_quatf> r(count);
+    std::vector<float> pose(POSE_COMPONENTS * count);
+    for (size_t i = 0; i < count; i++) {
+        t[i] = randomTranslation();
+        r[i] = simd_quaternion(randomUnitVector4());
+        s[i] = randomScale();
+        float const components[POSE_COMPONENTS] = { t[i].x, t[i].y, t[i].z,
+                r[i].vector.x, r[i].vector.y, r[i].vector.z, r[i].vector.w, s[i].x, s[i].y, s[i].z };
+        for (size_t c = 0; c < POSE_COMPONENTS; c++) {
+            pose[c * count + i] = components[c];
+        }
+    }
+    std::vector<simd_float4x4> batch(count), poses(count);
+    composeTRS(t.data(), r.data(), s.data(), count, batch.data());
+    composePoses(pose.data(), count, count, poses.data());
+    for (size_t i = 0; i < count; i++) {
+        simd_float4x4 const expected = composeTRS(t[i], r[i], s[i]);
+        CHECK(near(batch[i], expected, 0));
+        CHECK(near(poses[i], expected, 1e-5f));
+    }
+}
+
+void testRotationMatrices() {
+    simd_quatf const q[] = { QUARTER_TURN_Z, AXIS_CYCLE, simd_quaternion(0, 0, 0, 1) };
+    simd_float3x3 m[3];
+    rotationMatrices(q, 3, m);
+    CHECK(near(m[0], simd_matrix(simd_make_float3(0, 1, 0), simd_make_float3(-1, 0, 0),
+            simd_make_float3(0, 0, 1)), 1e-6f));
+    CHECK(near(m[1], simd_matrix(simd_make_float3(0, 1, 0), simd_make_float3(0, 0, 1),
+            simd_make_float3(1, 0, 0)), 1e-6f));
+    CHECK(near(m[2], identity3x3(), 0));
+}
+
+void testMultiplyAndTransform() {
+    simd_float4 const ones = simd_make_float4(1, 1, 1, 1);
+    simd_float4 v;
+    transform(TRS, &ones, 1, &v);
+    CHECK(near(v, simd_make_float4(-3, 4, 11, 1), 0));
+
+    simd_float4x4 const a[] = { TRS, identity4x4() };
+    simd_float4x4 const b[] = { identity4x4(), TRS };
+    simd_float4x4 product[2];
+    multiply(a, b, 2, product);
+    CHECK(near(product[0], TRS, 0));
+    CHECK(near(product[1], TRS, 0));
+    // (T R S)(T R S) with R S = [0 -4 0; 2 0 0; 0 0 8]
+    multiply(TRS, &TRS, 1, product);
+    CHECK(near(product[0], simd_matrix(simd_make_float4(-8, 0, 0, 0), simd_make_float4(0, -8, 0, 0),
+            simd_make_float4(0, 0, 64, 0), simd_make_float4(-7, 4, 27, 1)), 0));
+}
+
+void testAffineInverse() {
+    // S^-1 R^-1 T^-1, with S^-1 R^-1 = [0 0.5 0; -0.25 0 0; 0 0 0.125]
+    simd_float4x4 const inverse = simd_matrix(simd_make_float4(0, -0.25f, 0, 0),
+            simd_make_float4(0.5f, 0, 0, 0), simd_make_float4(0, 0, 0.125f, 0),
+            simd_make_float4(-1, 0.25f, -0.375f, 1));
+    CHECK(near(affineInverse(TRS), inverse, 1e-7f));
+    CHECK(near(affineInverse(identity4x4()), identity4x4(), 0));
+
+    // enough matrices to be spread over the cores, inverted in place
+    size_t const count = PARALLEL_MIN_COUNT + 5;
+    std::vector<simd_float4x4> m(count), inverses(count), products(count);
+    for (size_t i = 0; i < count; i++) {
+        m[i] = composeTRS(randomTranslation(), simd_quaternion(randomUnitVector4()), randomScale());
+    }
+    inverses = m;
+    affineInverse(inverses.data(), count, inverses.data());
+    multiply(inverses.data(), m.data(), count, products.data());
+    for (size_t i = 0; i < count; i++) {
+        if (!CHECK(near(products[i], identity4x4(), 2e-5f))) {
+            break;
+        }
+    }
+}
+
+void testNormalMatrices() {
+    // R S^-1, the inverse transpose of R S
+    simd_float3x3 const expected = simd_matrix(simd_make_float3(0, 0.5f, 0), simd_make_float3(-0.25f, 0, 0),
+            simd_make_float3(0, 0, 0.125f));
+    simd_float3x3 normal;
+    normalMatrices(&TRS, 1, &normal);
+    CHECK(near(normal, expected, 1e-7f));
+
+    // the columns of the normal matrix are orthogonal to all but the same column of the upper
+    // 3x3, so normals stay perpendicular to transformed tangents
+    size_t const count = 1000;
+    std::vector<simd_float4x4> m(count);
+    std::vector<simd_float3x3> normals(count);
+    for (size_t i = 0; i < count; i++) {
+        m[i] = composeTRS(randomTranslation(), simd_quaternion(randomUnitVector4()), randomScale());
+    }
+    normalMatrices(m.data(), count, normals.data());
+    for (size_t i = 0; i < count; i++) {
+        bool passed = true;
+        for (int j = 0; j < 3; j++) {
+            simd_float4 const c = m[i].columns[j];
+            for (int k = 0; k < 3; k++) {
+                float const dot = simd_dot(normals[i].columns[k], simd_make_float3(c.x, c.y, c.z));
+                passed = passed && near(dot, j == k ? 1.0f : 0.0f, 1e-5f);
+            }
+        }
+        if (!CHECK(passed)) {
+            break;
+        }
+    }
+}
+
+// slerp in double precision from the sines of the angle between the quaternions
+simd_quatf slerpReference(simd_quatf a, simd_quatf b, double t) {
+    double cosine = 0;
+    for (int k = 0; k < 4; k++) {
+        cosine += double(a.vector[k]) * double(b.vector[k]);
+    }
+    double const sign = cosine < 0 ? -1 : 1;
+    double const angle = std::acos(std::min(std::abs(cosine), 1.0));
+    double wa = 1 - t, wb = t;
+    if (angle > 1e-9) {
+        wa = std::sin((1 - t) * angle) / std::sin(angle);
+        wb = std::sin(t * angle) / std::sin(angle);
+    }
+    simd_float4 v;
+    for (int k = 0; k < 4; k++) {
+        v[k] = float(double(a.vector[k]) * wa + sign * double(b.vector[k]) * wb);
+    }
+    return simd_quaternion(v);
+}
+
+void testSlerp() {
+    simd_quatf const identity = simd_quaternion(0, 0, 0, 1);
+    // 45 degrees around z
+    simd_quatf const eighthTurnZ = simd_quaternion(0, 0, 0.382683432f, 0.923879533f);
+    CHECK(near(slerp(identity, QUARTER_TURN_Z, 0.5f), eighthTurnZ, 1e-6f));
+    CHECK(near(nlerp(identity, QUARTER_TURN_Z, 0.5f), eighthTurnZ, 1e-6f));
+    CHECK(near(slerp(identity, QUARTER_TURN_Z, 0), identity, 1e-6f));
+    CHECK(near(slerp(identity, QUARTER_TURN_Z, 1), QUARTER_TURN_Z, 1e-6f));
+    // q and -q are the same rotation, and the shorter arc is taken
+    simd_quatf const negated = simd_quaternion(-QUARTER_TURN_Z.vector);
+    CHECK(near(slerp(identity, negated, 0.5f), eighthTurnZ, 1e-6f));
+
+    // rotations from 0 to 180 degrees apart: the weights stay within 1e-6 up to 120 degrees
+    // and within 3e-5 beyond, plus the rounding of the quaternions
+    for (int step = 0; step <= 180; step++) {
+        float const halfAngle = float(step) * PI / 360;
+        simd_float4 const a = randomUnitVector4();
+        simd_float4 p = randomUnitVector4();
+        p = simd_normalize(p - a * simd_dot(a, p));
+        simd_quatf const qa = simd_quaternion(a);
+        simd_quatf const qb = simd_quaternion(simd_normalize(a * std::cos(halfAngle) + p * std::sin(halfAngle)));
+        float const tolerance = step <= 120 ? 2e-6f : 4e-5f;
+        for (int i = 0; i <= 10; i++) {
+            float const t = float(i) / 10;
+            if (!CHECK(near(slerp(qa, qb, t), slerpReference(qa, qb, t), tolerance))) {
+                std::fprintf(stderr, "  %d degrees apart, t = %g\n", step, t);
+                return;
+            }
+        }
+    }
+}
+
+void testInterpolatePoses() {
+    // eleven nodes, through both the eight-lane and the scalar paths
+    size_t const count = 11, stride = 16;
+    std::vector<float> a(POSE_COMPONENTS * stride), b(POSE_COMPONENTS * stride);
+    std::vector<simd_quatf> qa(count), qb(count);
+    for (size_t i = 0; i < count; i++) {
+        qa[i] = simd_quaternion(randomUnitVector4());
+        qb[i] = simd_quaternion(randomUnitVector4());
+        for (size_t c : { 0, 1, 2, 7, 8, 9 }) {
+            a[c * stride + i] = uniform(-10, 10);
+            b[c * stride + i] = uniform(-10, 10);
+        }
+        for (size_t k = 0; k < 4; k++) {
+            a[(3 + k) * stride + i] = qa[i].vector[k];
+            b[(3 + k) * stride + i] = qb[i].vector[k];
+        }
+    }
+    float const t = 0.3f;
+    for (bool const useSlerp : { true, false }) {
+        std::vector<float> result(POSE_COMPONENTS * stride);
+        interpolatePoses(a.data(), b.data(), stride, count, t, useSlerp, result.data());
+        for (size_t i = 0; i < count; i++) {
+            simd_quatf const expected = useSlerp ? slerp(qa[i], qb[i], t) : nlerp(qa[i], qb[i], t);
+            simd_quatf const actual = simd_quaternion(result[3 * stride + i], result[4 * stride + i],
+                    result[5 * stride + i], result[6 * stride + i]);
+            CHECK(near(actual, expected, 1e-6f));
+            for (size_t c : { 0, 1, 2, 7, 8, 9 }) {
+                float const lerp = a[c * stride + i] + (b[c * stride + i] - a[c * stride + i]) * t;
+                CHECK(near(result[c * stride + i], lerp, 1e-5f));
+            }
+        }
+    }
+}
+
+uint32_t bitsOf(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+float floatOf(uint32_t u) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+bool isNaNHalf(uint16_t h) {
+    return (h & 0x7fffu) > 0x7c00u;
+}
+
+// float to half in double precision: the value divided by the spacing of the half floats
+// around it, rounded to an integer, is the mantissa, carries included
+uint16_t halfReference(float f, HalfRounding rounding) {
+    uint16_t const sign = uint16_t((bitsOf(f) >> 16) & 0x8000u);
+    double const x = std::abs(double(f));
+    if (std::isnan(x)) {
+        return sign | 0x7e00u;
+    }
+    if (std::isinf(x)) {
+        return sign | 0x7c00u;
+    }
+    int exponent = -14;
+    if (x >= std::ldexp(1.0, -14)) {
+        std::frexp(x, &exponent);
+        exponent -= 1;
+    }
+    double const spacing = std::ldexp(1.0, exponent - 10);
+    double const mantissa = rounding == HalfRounding::NEAREST_EVEN
+            ? std::nearbyint(x / spacing) : std::trunc(x / spacing);
+    uint32_t bits = uint32_t((exponent + 14) << 10) + uint32_t(mantissa);
+    if (bits >= 0x7c00u) {
+        bits = rounding == HalfRounding::NEAREST_EVEN ? 0x7c00u : 0x7bffu;
+    }
+    return sign | uint16_t(bits);
+}
+
+float floatReference(uint16_t h) {
+    float const sign = (h & 0x8000u) ? -1.0f : 1.0f;
+    uint32_t const exponent = (h >> 10) & 0x1fu;
+    uint32_t const mantissa = h & 0x3ffu;
+    if (exponent == 0x1fu) {
+        return mantissa ? std::nanf("") : sign * INFINITY;
+    }
+    if (exponent == 0) {
+        return sign * float(std::ldexp(double(mantissa), -24));
+    }
+    return sign * float(std::ldexp(double(1024 + mantissa), int(exponent) - 25));
+}
+
+// converts each value alone, through the scalar path, and eight at a time
+std::vector<uint16_t> toHalves(std::vector<float> const& values, HalfRounding rounding) {
+    size_t const count = values.size();
+    std::vector<float> padded(count * 9);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < 9; k++) {
+            padded[i * 9 + k] = values[i];
+        }
+    }
+    std::vector<uint16_t> halves(count * 9), result(count);
+    for (size_t i = 0; i < count; i++) {
+        floatsToHalves(padded.data() + i * 9, 9, halves.data() + i * 9, rounding);
+        result[i] = halves[i * 9];
+        for (size_t k = 1; k < 9; k++) {
+            CHECK(halves[i * 9 + k] == result[i]);
+        }
+    }
+    return result;
+}
+
+void testFloatsToHalves() {
+    struct Golden {
+        float value;
+        uint16_t nearestEven;
+        uint16_t towardZero;
+    };
+    Golden const golden[] = {
+        { 0.0f, 0x0000, 0x0000 },
+        { -0.0f, 0x8000, 0x8000 },
+        { 1.0f, 0x3c00, 0x3c00 },
+        { -2.0f, 0xc000, 0xc000 },
+        { 0.333333343f, 0x3555, 0x3555 },
+        { 0.1f, 0x2e66, 0x2e66 },
+        { 3.14159274f, 0x4248, 0x4248 },
+        // halfway between 1 and the next half float rounds to even, below it...
+        { 1.00048828f, 0x3c00, 0x3c00 },
+        // ...and above it, up
+        { 1.00146484f, 0x3c02, 0x3c01 },
+        { 65504.0f, 0x7bff, 0x7bff },
+        { 65519.0f, 0x7bff, 0x7bff },
+        { 65520.0f, 0x7c00, 0x7bff },
+        { -1e10f, 0xfc00, 0xfbff },
+        { INFINITY, 0x7c00, 0x7c00 },
+        { -INFINITY, 0xfc00, 0xfc00 },
+        { std::nanf(""), 0x7e00, 0x7e00 },
+        // the smallest normal and denormal half floats, half of the latter, and three halves
+        { 6.10351562e-05f, 0x0400, 0x0400 },
+        { 5.96046448e-08f, 0x0001, 0x0001 },
+        { 2.98023224e-08f, 0x0000, 0x0000 },
+        { 8.94069672e-08f, 0x0002, 0x0001 },
+        { 1e-10f, 0x0000, 0x0000 },
+    };
+    std::vector<float> values;
+    for (Golden const& g : golden) {
+        values.push_back(g.value);
+    }
+    std::vector<uint16_t> const nearestEven = toHalves(values, HalfRounding::NEAREST_EVEN);
+    std::vector<uint16_t> const towardZero = toHalves(values, HalfRounding::TOWARD_ZERO);
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!CHECK(nearestEven[i] == golden[i].nearestEven && towardZero[i] == golden[i].towardZero)) {
+            std::fprintf(stderr, "  %g: %04x %04x\n", values[i], nearestEven[i], towardZero[i]);
+        }
+    }
+
+    // all the floats of the half float range and around it whose low bits are in a few
+    // patterns, which includes every halfway case
+    values.clear();
+    for (uint32_t exponent = 100; exponent < 146; exponent++) {
+        for (uint32_t high = 0; high < (1u << 14); high++) {
+            for (uint32_t low : { 0x000u, 0x001u, 0x1ffu }) {
+                uint32_t const bits = (exponent << 23) | (high << 9) | low;
+                values.push_back(floatOf(bits));
+                values.push_back(floatOf(bits | 0x80000000u));
+            }
+        }
+    }
+    std::vector<uint16_t> halves(values.size());
+    for (HalfRounding const rounding : { HalfRounding::NEAREST_EVEN, HalfRounding::TOWARD_ZERO }) {
+        floatsToHalves(values.data(), values.size(), halves.data(), rounding);
+        for (size_t i = 0; i < values.size(); i++) {
+            uint16_t const expected = halfReference(values[i], rounding);
+            if (!CHECK(halves[i] == expected)) {
+                std::fprintf(stderr, "  %08x: %04x instead of %04x\n", bitsOf(values[i]), halves[i], expected);
+                break;
+            }
+        }
+    }
+}
+
+void testHalvesToFloats() {
+    struct Golden {
+        uint16_t half;
+        float value;
+    };
+    Golden const golden[] = {
+        { 0x0000, 0.0f }, { 0x3c00, 1.0f }, { 0xc000, -2.0f }, { 0x3555, 0.333251953f },
+        { 0x7bff, 65504.0f }, { 0x0400, 6.10351562e-05f }, { 0x03ff, 6.09755516e-05f },
+        { 0x0001, 5.96046448e-08f }, { 0x7c00, INFINITY }, { 0xfc00, -INFINITY },
+    };
+    for (Golden const& g : golden) {
+        uint16_t halves[9];
+        float floats[9];
+        std::fill(halves, halves + 9, g.half);
+        halvesToFloats(halves, 9, floats);
+        for (float f : floats) {
+            if (!CHECK(bitsOf(f) == bitsOf(g.value))) {
+                std::fprintf(stderr, "  %04x: %g\n", g.half, f);
+                break;
+            }
+        }
+    }
+    float negativeZero;
+    uint16_t const signedZero = 0x8000;
+    halvesToFloats(&signedZero, 1, &negativeZero);
+    CHECK(bitsOf(negativeZero) == 0x80000000u);
+
+    // every half float, which is enough to be spread over the cores, and back
+    std::vector<uint16_t> halves(1 << 16);
+    for (uint32_t h = 0; h < halves.size(); h++) {
+        halves[h] = uint16_t(h);
+    }
+    std::vector<float> floats(halves.size());
+    halvesToFloats(halves.data(), halves.size(), floats.data());
+    for (uint32_t h = 0; h < halves.size(); h++) {
+        float const expected = floatReference(uint16_t(h));
+        bool const passed = isNaNHalf(uint16_t(h))
+                ? std::isnan(floats[h]) && std::signbit(floats[h]) == bool(h & 0x8000u)
+                : bitsOf(floats[h]) == bitsOf(expected);
+        if (!CHECK(passed)) {
+            std::fprintf(stderr, "  %04x: %g instead of %g\n", h, floats[h], expected);
+            break;
+        }
+    }
+    for (HalfRounding const rounding : { HalfRounding::NEAREST_EVEN, HalfRounding::TOWARD_ZERO }) {
+        std::vector<uint16_t> roundTrip(halves.size());
+        floatsToHalves(floats.data(), floats.size(), roundTrip.data(), rounding);
+        for (uint32_t h = 0; h < halves.size(); h++) {
+            bool const passed = isNaNHalf(uint16_t(h))
+                    ? isNaNHalf(roundTrip[h]) && (roundTrip[h] & 0x8000u) == (h & 0x8000u)
+                    : roundTrip[h] == h;
+            if (!CHECK(passed)) {
+                std::fprintf(stderr, "  %04x: %04x\n", h, roundTrip[h]);
+                break;
+            }
+        }
+    }
+}
+
+}
+
+int main() {
+    testComposeTRS();
+    testRotationMatrices();
+    testMultiplyAndTransform();
+    testAffineInverse();
+    testNormalMatrices();
+    testSlerp();
+    testInterpolatePoses();
+    testFloatsToHalves();
+    testHalvesToFloats();
+    if (failureCount > 0) {
+        std::fprintf(stderr, "%d checks failed\n", failureCount);
+        return 1;
+    }
+    std::printf("All checks passed\n");
+    return 0;
+}
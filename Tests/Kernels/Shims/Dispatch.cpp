@@ -0,0 +1,11 @@
+//
+//  Dispatch.cpp
+//
+//  The isa symbols referenced by blocks, for toolchains without a blocks runtime. The kernels
+//  only call their blocks on the stack, so nothing else of the runtime is needed.
+//
+
+extern "C" {
+void* _NSConcreteStackBlock[32];
+void* _NSConcreteGlobalBlock[32];
+}
@@ -0,0 +1,11 @@
+//
+//  Foundation.h
+//
+//  Empty stand-in for the Foundation import of Bindings/Filament/Box.h, whose structs only
+//  need <simd/simd.h>.
+//
+
+#ifndef Shims_Foundation_h
+#define Shims_Foundation_h
+
+#endif /* Shims_Foundation_h */
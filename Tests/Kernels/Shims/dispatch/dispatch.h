@@ -0,0 +1,21 @@
+//
+//  dispatch.h
+//
+//  dispatch_apply for Bindings/Kernels.h on Linux, running the iterations in order on the
+//  calling thread. Blocks need -fblocks; Dispatch.cpp provides their runtime symbols.
+//
+
+#ifndef Shims_dispatch_h
+#define Shims_dispatch_h
+
+#include <stddef.h>
+
+#define DISPATCH_APPLY_AUTO nullptr
+
+inline void dispatch_apply(size_t iterations, void*, void (^block)(size_t)) {
+    for (size_t i = 0; i < iterations; i++) {
+        block(i);
+    }
+}
+
+#endif /* Shims_dispatch_h */
@@ -0,0 +1,107 @@
+//
+//  simd.h
+//
+//  The subset of Apple's <simd/simd.h> used by Bindings/Kernels.h, over Clang's vector
+//  extensions, so that the kernels build and run on Linux.
+//
+
+#ifndef Shims_simd_h
+#define Shims_simd_h
+
+#include <cmath>
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef float simd_float3 __attribute__((ext_vector_type(3)));
+typedef float simd_float4 __attribute__((ext_vector_type(4)));
+typedef float simd_float8 __attribute__((ext_vector_type(8)));
+typedef float simd_packed_float8 __attribute__((ext_vector_type(8), aligned(4)));
+typedef int simd_int8 __attribute__((ext_vector_type(8)));
+typedef unsigned int simd_uint8 __attribute__((ext_vector_type(8)));
+typedef unsigned short simd_ushort8 __attribute__((ext_vector_type(8)));
+
+typedef struct { simd_float3 columns[3]; } simd_float3x3;
+typedef struct { simd_float4 columns[4]; } simd_float4x4;
+typedef struct { simd_float4 vector; } simd_quatf;
+
+inline simd_float3 simd_make_float3(float x, float y, float z) { return simd_float3{ x, y, z }; }
+inline simd_float4 simd_make_float4(float x, float y, float z, float w) { return simd_float4{ x, y, z, w }; }
+inline simd_float4 simd_make_float4(simd_float3 xyz, float w) { return simd_float4{ xyz.x, xyz.y, xyz.z, w }; }
+
+inline simd_float4 simd_abs(simd_float4 v) {
+    return simd_make_float4(std::abs(v.x), std::abs(v.y), std::abs(v.z), std::abs(v.w));
+}
+
+inline simd_float3 simd_min(simd_float3 a, simd_float3 b) {
+    return simd_make_float3(std::fmin(a.x, b.x), std::fmin(a.y, b.y), std::fmin(a.z, b.z));
+}
+
+inline simd_float3 simd_max(simd_float3 a, simd_float3 b) {
+    return simd_make_float3(std::fmax(a.x, b.x), std::fmax(a.y, b.y), std::fmax(a.z, b.z));
+}
+
+inline simd_uint8 simd_min(simd_uint8 a, simd_uint8 b) {
+    for (int i = 0; i < 8; i++) {
+        a[i] = b[i] < a[i] ? b[i] : a[i];
+    }
+    return a;
+}
+
+inline simd_float8 simd_sqrt(simd_float8 v) {
+    for (int i = 0; i < 8; i++) {
+        v[i] = std::sqrt(v[i]);
+    }
+    return v;
+}
+
+inline float simd_dot(simd_float3 a, simd_float3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline float simd_dot(simd_float4 a, simd_float4 b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+inline simd_float3 simd_cross(simd_float3 a, simd_float3 b) {
+    return a.yzx * b.zxy - a.zxy * b.yzx;
+}
+
+inline simd_float4 simd_normalize(simd_float4 v) { return v / std::sqrt(simd_dot(v, v)); }
+
+inline simd_float3x3 simd_matrix(simd_float3 c0, simd_float3 c1, simd_float3 c2) {
+    return simd_float3x3{ { c0, c1, c2 } };
+}
+
+inline simd_float4x4 simd_matrix(simd_float4 c0, simd_float4 c1, simd_float4 c2, simd_float4 c3) {
+    return simd_float4x4{ { c0, c1, c2, c3 } };
+}
+
+inline simd_float3x3 simd_transpose(simd_float3x3 const& m) {
+    auto const& c = m.columns;
+    return simd_matrix(simd_make_float3(c[0].x, c[1].x, c[2].x), simd_make_float3(c[0].y, c[1].y, c[2].y),
+            simd_make_float3(c[0].z, c[1].z, c[2].z));
+}
+
+inline simd_float3 simd_mul(simd_float3x3 const& m, simd_float3 v) {
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z;
+}
+
+inline simd_float4 simd_mul(simd_float4x4 const& m, simd_float4 v) {
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z + m.columns[3] * v.w;
+}
+
+inline simd_float4x4 simd_mul(simd_float4x4 const& a, simd_float4x4 const& b) {
+    return simd_matrix(simd_mul(a, b.columns[0]), simd_mul(a, b.columns[1]), simd_mul(a, b.columns[2]),
+            simd_mul(a, b.columns[3]));
+}
+
+inline simd_quatf simd_quaternion(simd_float4 v) { return simd_quatf{ v }; }
+inline simd_quatf simd_quaternion(float ix, float iy, float iz, float r) {
+    return simd_quatf{ simd_make_float4(ix, iy, iz, r) };
+}
+
+inline simd_float3x3 simd_matrix3x3(simd_quatf q) {
+    float const x = q.vector.x, y = q.vector.y, z = q.vector.z, w = q.vector.w;
+    return simd_matrix(
+            simd_make_float3(1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y)),
+            simd_make_float3(2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x)),
+            simd_make_float3(2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y)));
+}
+
+#endif /* Shims_simd_h */